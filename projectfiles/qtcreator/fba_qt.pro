@@ -115,19 +115,6 @@ GENERATED.commands =                                \
     mkdir generated;                                \
     touch generated/empty
 
-#-------------------------------------------------------------------------------
-# src/dep/generated/ctv.h
-#-------------------------------------------------------------------------------
-CTV_HEADER.depends = GENERATED
-CTV_HEADER.target = $$GEN/ctv.h
-
-CTV_HEADER.commands =                               \
-    @echo "Building ctv...";                        \
-    cd $$SRC/burn/drv/capcom;                       \
-    $$QMAKE_CXX ctv_make.cpp -o ctv_make;           \
-    ./ctv_make > $$CTV_HEADER.target;         \
-    rm ctv_make
-
 #-------------------------------------------------------------------------------
 # perl scripts
 #-------------------------------------------------------------------------------
@@ -269,7 +256,6 @@ macx {
 #-------------------------------------------------------------------------------
 QMAKE_EXTRA_TARGETS +=      \
     GENERATED               \
-    CTV_HEADER              \
     CAVE_SPRFUNC_HEADER     \
     CAVE_TILEFUNC_HEADER    \
     NEO_SPRFUNC_HEADER      \
@@ -287,7 +273,6 @@ QMAKE_EXTRA_TARGETS +=      \
     M68K_LIB
 
 PRE_TARGETDEPS +=                               \
-    $$CTV_HEADER.target                         \
     $$CAVE_SPRFUNC_HEADER.target                \
     $$CAVE_TILEFUNC_HEADER.target               \
     $$NEO_SPRFUNC_HEADER.target                 \
@@ -309,7 +294,6 @@ $$DRV_CAPCOM {
 
         HEADERS += $$files(../../src/burn/drv/capcom/*.h)
         SOURCES += $$files(../../src/burn/drv/capcom/*.cpp)
-        SOURCES -= ../../src/burn/drv/capcom/ctv_make.cpp
 }
 
 #===============================================================================
@@ -427,7 +411,6 @@ $$DRV_PRE90S {
         # CAPCOM deps...
         HEADERS *= $$files(../../src/burn/drv/capcom/*.h)
         SOURCES *= $$files(../../src/burn/drv/capcom/*.cpp)
-        SOURCES -= ../../src/burn/drv/capcom/ctv_make.cpp
         # KONAMI deps...
         HEADERS *= $$files(../../src/burn/drv/konami/*.h)
         SOURCES *= $$files(../../src/burn/drv/konami/k*.cpp)
@@ -543,6 +526,7 @@ SOURCES += \
     ../../src/burn/snd/msm5205.cpp \
     ../../src/burn/snd/msm5232.cpp \
     ../../src/burn/snd/msm6295.cpp \
+    ../../src/burn/snd/adpcm_cache.cpp \
     ../../src/burn/snd/namco_snd.cpp \
     ../../src/burn/snd/nes_apu.cpp \
     ../../src/burn/snd/rf5c68.cpp \
@@ -574,6 +558,9 @@ SOURCES += \
     ../../src/burn/burn_sound_c.cpp \
     ../../src/burn/burn_memory.cpp \
     ../../src/burn/burn_led.cpp \
+    ../../src/burn/burn_profile.cpp \
+    ../../src/burn/burn_cache.cpp \
+    ../../src/burn/burn_thread.cpp \
     ../../src/burn/burn_gun.cpp \
     ../../src/cpu/hd6309_intf.cpp \
     ../../src/cpu/konami_intf.cpp \
@@ -758,6 +745,7 @@ HEADERS += \
     ../../src/burn/snd/msm5205.h \
     ../../src/burn/snd/msm5232.h \
     ../../src/burn/snd/msm6295.h \
+    ../../src/burn/snd/adpcm_cache.h \
     ../../src/burn/snd/namco_snd.h \
     ../../src/burn/snd/nes_apu.h \
     ../../src/burn/snd/nes_defs.h \
@@ -789,6 +777,9 @@ HEADERS += \
     ../../src/burn/vector.h \
     ../../src/burn/version.h \
     ../../src/burn/burn_led.h \
+    ../../src/burn/burn_profile.h \
+    ../../src/burn/burn_cache.h \
+    ../../src/burn/burn_thread.h \
     ../../src/burn/burn_gun.h \
     ../../src/burn/bitswap.h \
     ../../src/cpu/h6280_intf.h \
@@ -939,7 +930,7 @@ $$DRC_MIPS3_X64 {
 #-------------------------------------------------------------------------------
 # Linux only drivers
 #-------------------------------------------------------------------------------
-linux: HEADERS += ../../src/intf/audio/linux/ringbuffer.h
+linux: HEADERS += ../../src/intf/audio/ringbuffer.h
 linux: SOURCES += ../../src/intf/audio/linux/aud_pulse_simple.cpp
 
 OTHER_FILES +=
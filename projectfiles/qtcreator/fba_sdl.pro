@@ -100,19 +100,6 @@ GENERATED.commands =                                \
     mkdir generated;                                \
     touch generated/empty
 
-#-------------------------------------------------------------------------------
-# src/dep/generated/ctv.h
-#-------------------------------------------------------------------------------
-CTV_HEADER.depends = GENERATED
-CTV_HEADER.target = $$GEN/ctv.h
-
-CTV_HEADER.commands =                               \
-    @echo "Building ctv...";                        \
-    cd $$SRC/burn/drv/capcom;                       \
-    $$QMAKE_CXX ctv_make.cpp -o ctv_make;           \
-    ./ctv_make > $$CTV_HEADER.target;         \
-    rm ctv_make
-
 #-------------------------------------------------------------------------------
 # perl scripts
 #-------------------------------------------------------------------------------
@@ -253,7 +240,6 @@ DRIVERLIST.commands = \
 #-------------------------------------------------------------------------------
 QMAKE_EXTRA_TARGETS +=      \
     GENERATED               \
-    CTV_HEADER              \
     CAVE_SPRFUNC_HEADER     \
     CAVE_TILEFUNC_HEADER    \
     NEO_SPRFUNC_HEADER      \
@@ -271,7 +257,6 @@ QMAKE_EXTRA_TARGETS +=      \
     M68K_LIB
 
 PRE_TARGETDEPS +=                               \
-    $$CTV_HEADER.target                         \
     $$CAVE_SPRFUNC_HEADER.target                \
     $$CAVE_TILEFUNC_HEADER.target               \
     $$NEO_SPRFUNC_HEADER.target                 \
@@ -291,8 +276,7 @@ $$DRV_CAPCOM {
 	message("Capcom drivers enabled")
 
 	HEADERS += \
-	    ../../src/burn/drv/capcom/cps.h \
-	    ../../src/burn/drv/capcom/ctv_do.h
+	    ../../src/burn/drv/capcom/cps.h
 	
 	SOURCES += \
 	    ../../src/burn/drv/capcom/cps_config.cpp \
@@ -931,6 +915,7 @@ SOURCES += \
     ../../src/burn/snd/msm5205.cpp \
     ../../src/burn/snd/msm5232.cpp \
     ../../src/burn/snd/msm6295.cpp \
+    ../../src/burn/snd/adpcm_cache.cpp \
     ../../src/burn/snd/namco_snd.cpp \
     ../../src/burn/snd/nes_apu.cpp \
     ../../src/burn/snd/rf5c68.cpp \
@@ -961,6 +946,9 @@ SOURCES += \
     ../../src/burn/burn_sound_c.cpp \
     ../../src/burn/burn_memory.cpp \
     ../../src/burn/burn_led.cpp \
+    ../../src/burn/burn_profile.cpp \
+    ../../src/burn/burn_cache.cpp \
+    ../../src/burn/burn_thread.cpp \
     ../../src/burn/burn_gun.cpp \
     ../../src/cpu/hd6309_intf.cpp \
     ../../src/cpu/konami_intf.cpp \
@@ -1128,6 +1116,7 @@ HEADERS += \
     ../../src/burn/snd/msm5205.h \
     ../../src/burn/snd/msm5232.h \
     ../../src/burn/snd/msm6295.h \
+    ../../src/burn/snd/adpcm_cache.h \
     ../../src/burn/snd/namco_snd.h \
     ../../src/burn/snd/nes_apu.h \
     ../../src/burn/snd/nes_defs.h \
@@ -1158,6 +1147,9 @@ HEADERS += \
     ../../src/burn/vector.h \
     ../../src/burn/version.h \
     ../../src/burn/burn_led.h \
+    ../../src/burn/burn_profile.h \
+    ../../src/burn/burn_cache.h \
+    ../../src/burn/burn_thread.h \
     ../../src/burn/burn_gun.h \
     ../../src/burn/bitswap.h \
     ../../src/cpu/h6280_intf.h \
@@ -4,6 +4,8 @@
 #include "burnint.h"
 #include "timer.h"
 #include "burn_sound.h"
+#include "burn_thread.h"
+#include "burn_profile.h"
 #include "driverlist.h"
 
 #ifndef __LIBRETRO__
@@ -56,6 +58,13 @@ INT16* pBurnSoundOut = NULL;		// pointer to output buffer
 
 INT32 nInterpolation = 1;				// Desired interpolation level for ADPCM/PCM sound
 INT32 nFMInterpolation = 0;			// Desired interpolation level for FM sound
+bool bBurnSampleStreaming = false;		// Load samples on first play and convert them in chunks (low-ram)
+INT32 nBurnADPCMCacheSize = 0;			// Pre-decoded ADPCM cache budget in KB (MSM6295, YM2610 ADPCM-A), 0 = off
+INT32 nBurnThreads = 0;					// Worker threads for the parallel renderers (GenericTilemapDraw, ...), 0/1 = off
+INT32 bBurnProfileStartup = 0;				// Print where the time goes while starting a game (burn_profile.h)
+char szBurnCachePath[MAX_PATH] = "";		// Directory for the decoded ROM cache (burn_cache.h), empty = off
+INT32 bBurnCacheShare = 0;					// Map decoded ROM cache entries, instances running the same set share them
+INT32 bBurnZipMapShare = 0;					// Map page aligned stored zip entries in place, the romsets must not change while in use
 
 UINT8 nBurnLayer = 0xFF;	// Can be used externally to select which layers to show
 UINT8 nSpriteEnable = 0xFF;	// Can be used externally to select which layers to show
@@ -84,7 +93,6 @@ extern "C" INT32 BurnLibInit()
 	BurnLibExit();
 	nBurnDrvCount = sizeof(pDriver) / sizeof(pDriver[0]);	// count available drivers
 
-	cmc_4p_Precalc();
 	bBurnUseMMX = BurnCheckMMXSupport();
 
 	return 0;
@@ -94,6 +102,8 @@ extern "C" INT32 BurnLibExit()
 {
 	nBurnDrvCount = 0;
 
+	BurnThreadExit();
+
 	return 0;
 }
 
@@ -650,8 +660,14 @@ extern "C" INT32 BurnDrvInit()
 	BurnRandomInit();
 	BurnSoundDCFilterReset();
 
+	BurnProfileStart(BurnDrvGetTextA(DRV_NAME));		// the frontend may have started it already, to include the archive scan
+	BurnProfileBegin("driver init");
+
 	nReturnValue = pDriver[nBurnDrvActive]->Init();	// Forward to drivers function
 
+	BurnProfileEnd();
+	BurnProfileStop();
+
 	nMaxPlayers = pDriver[nBurnDrvActive]->Players;
 
 	nCurrentFrame = 0;
@@ -891,6 +907,9 @@ void BurnNibbleExpand(UINT8 *source, UINT8 *dst, INT32 length, INT32 swap, UINT8
 // Application-defined rom loading function:
 INT32 (__cdecl *BurnExtLoadRom)(UINT8 *Dest, INT32 *pnWrote, INT32 i) = NULL;
 
+// Application-defined crc of the file loaded for a rom
+UINT32 (__cdecl *BurnExtRomCrc)(INT32 i) = NULL;
+
 // Application-defined colour conversion function
 static UINT32 __cdecl BurnHighColFiller(INT32, INT32, INT32, INT32) { return (UINT32)(~0); }
 UINT32 (__cdecl *BurnHighCol) (INT32 r, INT32 g, INT32 b, INT32 i) = BurnHighColFiller;
@@ -100,6 +100,10 @@ enum BurnCartrigeCommand { CART_INIT_START, CART_INIT_END, CART_EXIT };
 // Application-defined rom loading function
 extern INT32 (__cdecl *BurnExtLoadRom)(UINT8* Dest, INT32* pnWrote, INT32 i);
 
+// Application-defined: crc of the file BurnExtLoadRom() will load for rom i (0 = not found),
+// the decoded ROM cache (burn_cache.h) is keyed on it and stays off while this is NULL
+extern UINT32 (__cdecl *BurnExtRomCrc)(INT32 i);
+
 // Application-defined progress indicator functions
 extern INT32 (__cdecl *BurnExtProgressRangeCallback)(double dProgressRange);
 extern INT32 (__cdecl *BurnExtProgressUpdateCallback)(double dProgress, const TCHAR* pszText, bool bAbs);
@@ -274,6 +278,13 @@ extern INT16* pBurnSoundOut;				// Pointer to output buffer
 
 extern INT32 nInterpolation;					// Desired interpolation level for ADPCM/PCM sound
 extern INT32 nFMInterpolation;				// Desired interpolation level for FM sound
+extern bool bBurnSampleStreaming;			// Load samples on first play and convert them in chunks (low-ram)
+extern INT32 nBurnADPCMCacheSize;			// Pre-decoded ADPCM cache budget in KB (MSM6295, YM2610 ADPCM-A), 0 = off
+extern INT32 nBurnThreads;					// Worker threads for the parallel renderers (GenericTilemapDraw, ...), 0/1 = off
+extern INT32 bBurnProfileStartup;			// Print where the time goes while starting a game (burn_profile.h)
+extern char szBurnCachePath[MAX_PATH];		// Directory for the decoded ROM cache (burn_cache.h), empty = off
+extern INT32 bBurnCacheShare;				// Map decoded ROM cache entries, instances running the same set share them
+extern INT32 bBurnZipMapShare;				// Map page aligned stored zip entries in place, the romsets must not change while in use
 
 extern UINT32 *pBurnDrvPalette;
 
@@ -324,6 +335,9 @@ void BurnRandomSetSeed(UINT64 nSeed);               // Set the seed - useful for
 INT32 BurnSynchroniseStream(INT32 nSoundRate);
 double BurnGetTime();
 
+// Is this range inside a block BurnMalloc() mmap'd itself, files may only be mapped over those
+INT32 BurnMallocMapped(const void *ptr, INT32 nLen);
+
 // Handy debug binary-file dumper
 #if defined (FBNEO_DEBUG)
 void BurnDump_(char *filename, UINT8 *buffer, INT32 bufsize);
@@ -0,0 +1,287 @@
+// FB Neo decoded ROM cache, see burn_cache.h
+
+#include "burnint.h"
+#include "burn_cache.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CACHE_MMAP
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdint.h>
+#endif
+
+#define CACHE_MAGIC			0x48434246	// "FBCH"
+#define CACHE_FORMAT		1
+#define CACHE_HEADER_SIZE	0x1000		// region data starts on a page boundary
+
+struct CacheHeader {
+	UINT32 nMagic;
+	UINT32 nFormat;
+	INT32 nVersion;
+	INT32 nLen;
+	UINT64 nKey;
+	UINT64 nSum;
+};
+
+static UINT64 CacheHashBytes(UINT64 h, const void *pData, INT32 nLen)
+{
+	const UINT8 *p = (const UINT8*)pData;
+
+	for (INT32 i = 0; i < nLen; i++) {
+		h = (h ^ p[i]) * 0x100000001b3ULL;	// FNV-1a
+	}
+
+	return h;
+}
+
+// checksum of the region data, a word at a time since regions run to tens of MB,
+// start with h = CACHE_SUM_SEED(total length), only the last piece may be a partial word
+#define CACHE_SUM_SEED(len)	(0xcbf29ce484222325ULL ^ (UINT64)(len))
+
+static UINT64 CacheHashData(UINT64 h, const UINT8 *pData, INT32 nLen)
+{
+	INT32 i = 0;
+
+	for (; i + 8 <= nLen; i += 8) {
+		UINT64 w;
+		memcpy(&w, pData + i, 8);
+		h = (h ^ w) * 0x9e3779b97f4a7c15ULL;
+		h ^= h >> 29;
+	}
+
+	return CacheHashBytes(h, pData + i, nLen - i);
+}
+
+// everything the decoded region depends on: the crcs are those of the files the frontend
+// actually loads, so a bad dump or a different revision never shares an entry with the
+// good set.  IPS patches are applied as the roms load, the cache is off while they're on.
+// Returns 1 when the cache can't be used
+static INT32 CacheKey(const char *szTag, INT32 nVersion, INT32 nLen, UINT64 *pnKey)
+{
+	if (BurnExtRomCrc == NULL || bDoIpsPatch) return 1;
+
+	const char *szName = BurnDrvGetTextA(DRV_NAME);
+	UINT64 h = 0xcbf29ce484222325ULL;
+
+	h = CacheHashBytes(h, szName, strlen(szName) + 1);
+	h = CacheHashBytes(h, szTag, strlen(szTag) + 1);
+
+	for (INT32 i = 0; ; i++) {
+		struct BurnRomInfo ri;
+		memset(&ri, 0, sizeof(ri));
+
+		if (BurnDrvGetRomInfo(&ri, i)) break;
+
+		UINT32 nCrc = BurnExtRomCrc(i);
+
+		h = CacheHashBytes(h, &ri.nLen, sizeof(ri.nLen));
+		h = CacheHashBytes(h, &nCrc, sizeof(nCrc));
+		h = CacheHashBytes(h, &ri.nType, sizeof(ri.nType));
+	}
+
+	INT32 nExtra[3] = { nVersion, nLen, CACHE_FORMAT };
+#ifdef LSB_FIRST
+	nExtra[2] |= 0x100;
+#endif
+
+	*pnKey = CacheHashBytes(h, nExtra, sizeof(nExtra));
+
+	return 0;
+}
+
+static INT32 CacheFileName(char *szName, INT32 nSize, const char *szTag, UINT64 nKey)
+{
+	if (szBurnCachePath[0] == '\0') return 1;
+
+	INT32 nPathLen = strlen(szBurnCachePath);
+	const char *szSep = (szBurnCachePath[nPathLen - 1] == '/' || szBurnCachePath[nPathLen - 1] == '\\') ? "" : "/";
+
+	snprintf(szName, nSize, "%s%s%s.%s.%08x%08x.cache", szBurnCachePath, szSep, BurnDrvGetTextA(DRV_NAME), szTag, (UINT32)(nKey >> 32), (UINT32)nKey);
+
+	return 0;
+}
+
+// open an entry and check its header, the file is left positioned at the region data
+static FILE *CacheOpen(const char *szTag, INT32 nVersion, INT32 nLen, CacheHeader *pHeader, char *szName, INT32 nNameSize)
+{
+	UINT64 nKey;
+
+	if (CacheKey(szTag, nVersion, nLen, &nKey) || CacheFileName(szName, nNameSize, szTag, nKey)) return NULL;
+
+	FILE *fp = fopen(szName, "rb");
+	if (fp == NULL) return NULL;
+
+	if (fread(pHeader, sizeof(CacheHeader), 1, fp) != 1 || pHeader->nMagic != CACHE_MAGIC || pHeader->nFormat != CACHE_FORMAT ||
+		pHeader->nVersion != nVersion || pHeader->nLen != nLen || pHeader->nKey != nKey || fseek(fp, CACHE_HEADER_SIZE, SEEK_SET))
+	{
+		fclose(fp);
+		return NULL;
+	}
+
+	return fp;
+}
+
+// Map the region data of an entry over pDest (bBurnCacheShare).  Only whole pages are
+// mapped, so the head and tail of the region are left for the caller to read.  The
+// mapping is MAP_PRIVATE: a driver writing to its region gets its own copy of that page,
+// everything else stays in the page cache and is shared by every instance running the
+// same set.  Entries are only ever replaced by a rename, so a mapped file never changes
+// underneath us.  pDest has to lie in one of the blocks BurnMalloc mmaps for rom regions,
+// those are ours to map over and BurnFree() munmaps them with the file pages in them, heap
+// memory (malloc'd, or small BurnMalloc blocks) is never touched and just read into.
+// Returns the mapped byte range in *pnHead / *pnBody, 0 on success.
+//
+// With bSwap set pDest already holds the data (BurnCacheSave()) and must never be lost:
+// the file is mapped elsewhere first and only moved over pDest in one step, so on any
+// failure pDest is left as it was.  Where that can't be done atomically it isn't done.
+static INT32 CacheMap(const char *szName, UINT8 *pDest, INT32 nLen, INT32 bSwap, INT32 *pnHead, INT32 *pnBody)
+{
+	*pnHead = nLen;
+	*pnBody = 0;
+
+#ifdef CACHE_MMAP
+	if (!bBurnCacheShare || !BurnMallocMapped(pDest, nLen)) return 1;
+
+#ifndef MREMAP_FIXED
+	if (bSwap) return 1;
+#endif
+
+	INT64 nPage = sysconf(_SC_PAGESIZE);
+	if (nPage <= 0 || (((uintptr_t)pDest - CACHE_HEADER_SIZE) & (nPage - 1))) return 1;
+
+	INT32 nHead = (nPage - ((uintptr_t)pDest & (nPage - 1))) & (nPage - 1);
+	if (nHead > nLen) return 1;
+	INT32 nBody = ((nLen - nHead) / nPage) * nPage;
+	if (nBody == 0) return 1;
+
+	INT32 fd = open(szName, O_RDONLY);
+	if (fd < 0) return 1;
+
+	if (bSwap) {
+#ifdef MREMAP_FIXED
+		void *pMap = mmap(NULL, nBody, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, CACHE_HEADER_SIZE + nHead);
+		close(fd);
+
+		if (pMap == MAP_FAILED) return 1;
+
+		if (mremap(pMap, nBody, nBody, MREMAP_MAYMOVE | MREMAP_FIXED, pDest + nHead) == MAP_FAILED) {
+			munmap(pMap, nBody);
+			return 1;
+		}
+#endif
+	} else {
+		if (mmap(pDest + nHead, nBody, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, CACHE_HEADER_SIZE + nHead) == MAP_FAILED) {
+			// put anonymous pages back, a failed MAP_FIXED may have dropped what was there,
+			// the caller reads the whole region in
+			mmap(pDest + nHead, nBody, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+			close(fd);
+			return 1;
+		}
+
+		close(fd);
+	}
+
+	*pnHead = nHead;
+	*pnBody = nBody;
+
+	return 0;
+#else
+	(void)szName;
+	(void)pDest;
+	(void)bSwap;
+	return 1;
+#endif
+}
+
+INT32 BurnCacheCheck(const char *szTag, INT32 nVersion, INT32 nLen)
+{
+	char szName[MAX_PATH * 2];
+	CacheHeader header;
+	FILE *fp = CacheOpen(szTag, nVersion, nLen, &header, szName, sizeof(szName));
+	if (fp == NULL) return 0;
+
+	// only the header and the file size are checked here, the data checksum is left to
+	// BurnCacheLoad() so a warm start reads every entry just once
+	INT32 nRet = (fseek(fp, 0, SEEK_END) == 0 && ftell(fp) == (long)CACHE_HEADER_SIZE + nLen);
+
+	fclose(fp);
+
+	return nRet;
+}
+
+INT32 BurnCacheLoad(const char *szTag, INT32 nVersion, UINT8 *pDest, INT32 nLen)
+{
+	char szName[MAX_PATH * 2];
+	CacheHeader header;
+	FILE *fp = CacheOpen(szTag, nVersion, nLen, &header, szName, sizeof(szName));
+	if (fp == NULL) return 1;
+
+	INT32 nHead, nBody;
+	CacheMap(szName, pDest, nLen, 0, &nHead, &nBody);
+
+	// read whatever wasn't mapped, the checksum below goes over the mapped pages as well
+	INT32 nRet = (fread(pDest, 1, nHead, fp) != (size_t)nHead);
+	if (nRet == 0 && nHead + nBody < nLen) {
+		nRet = (fseek(fp, CACHE_HEADER_SIZE + nHead + nBody, SEEK_SET) || fread(pDest + nHead + nBody, 1, nLen - nHead - nBody, fp) != (size_t)(nLen - nHead - nBody));
+	}
+	nRet |= (CacheHashData(CACHE_SUM_SEED(nLen), pDest, nLen) != header.nSum);
+
+	fclose(fp);
+
+	if (nRet) {
+		bprintf(PRINT_ERROR, _T("*** Bad cache entry for region %hs\n"), szTag);
+		memset(pDest, 0, nLen);
+		remove(szName);									// decoded again on the next start
+	}
+
+	return nRet;
+}
+
+void BurnCacheSave(const char *szTag, INT32 nVersion, const UINT8 *pSrc, INT32 nLen)
+{
+	char szName[MAX_PATH * 2];
+	char szTemp[MAX_PATH * 2 + 4];
+	UINT64 nKey;
+
+	if (CacheKey(szTag, nVersion, nLen, &nKey) || CacheFileName(szName, sizeof(szName), szTag, nKey)) return;
+
+	CacheHeader header;
+	memset(&header, 0, sizeof(header));
+	header.nMagic = CACHE_MAGIC;
+	header.nFormat = CACHE_FORMAT;
+	header.nVersion = nVersion;
+	header.nLen = nLen;
+	header.nKey = nKey;
+	header.nSum = CacheHashData(CACHE_SUM_SEED(nLen), pSrc, nLen);
+
+	// written under a temporary name and renamed, so a half written entry is never seen
+	snprintf(szTemp, sizeof(szTemp), "%s.tmp", szName);
+
+	FILE *fp = fopen(szTemp, "wb");
+	if (fp == NULL) return;
+
+	UINT8 pad[CACHE_HEADER_SIZE];
+	memset(pad, 0, sizeof(pad));
+	memcpy(pad, &header, sizeof(header));
+
+	INT32 nRet = (fwrite(pad, 1, CACHE_HEADER_SIZE, fp) != CACHE_HEADER_SIZE || fwrite(pSrc, 1, nLen, fp) != (size_t)nLen);
+	nRet |= fclose(fp);
+
+	if (nRet) {
+		remove(szTemp);
+		return;
+	}
+
+	remove(szName);
+	if (rename(szTemp, szName)) {
+		remove(szTemp);
+		return;
+	}
+
+	// swap the decoded region for the pages of the file just written (same data), so the
+	// first instance shares them with the ones that start after it, if that fails the
+	// region is left alone
+	INT32 nHead, nBody;
+	CacheMap(szName, (UINT8*)pSrc, nLen, 1, &nHead, &nBody);
+}
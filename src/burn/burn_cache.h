@@ -0,0 +1,33 @@
+// Persistent cache for decoded/decrypted ROM regions
+//
+// Regions which are a pure function of the ROM set (decrypted code, pre-processed
+// graphics) can be stored after the first start and read back on the next one,
+// skipping the decode.  Entries are keyed on the driver name, the length/type of
+// every ROM in the set with the CRC of the file actually found for it (as reported
+// by BurnExtRomCrc), the region tag and a per-region decode version, so a changed
+// ROM set, a bad dump or a changed decoder never picks up stale data.  Bump nVersion
+// whenever the decode of a region changes.
+//
+// The cache is off while szBurnCachePath is empty, while the frontend doesn't set
+// BurnExtRomCrc and while IPS patches are applied.  Each entry is one file with a
+// 4KB header, so the region data itself is page aligned in the file.
+//
+// With bBurnCacheShare set (POSIX only) entries are mapped over the region instead of
+// read into it, where the region is in a big BurnMalloc block (those are mmap'd and
+// page aligned, see BurnMallocMapped).
+// Several instances running the same set then share one copy of the region through
+// the page cache rather than each holding their own, the entry file being the named
+// shared memory keyed on the set.  Pages a driver writes to become private to it.
+
+// 1 when an entry for this region exists and is complete (the data checksum is only
+// checked by BurnCacheLoad, a caller that skipped loading roms on the strength of this
+// has to fail its init if the load then fails)
+INT32 BurnCacheCheck(const char *szTag, INT32 nVersion, INT32 nLen);
+
+// read a region into pDest, returns 0 on success (pDest is cleared and the entry
+// removed on a bad one)
+INT32 BurnCacheLoad(const char *szTag, INT32 nVersion, UINT8 *pDest, INT32 nLen);
+
+// store a region after it has been decoded (with bBurnCacheShare, the region is then
+// mapped from the new entry, so pSrc keeps its contents but may change its backing)
+void BurnCacheSave(const char *szTag, INT32 nVersion, const UINT8 *pSrc, INT32 nLen);
@@ -6,6 +6,12 @@
 
 #include "burnint.h"
 
+#if defined(__unix__) || defined(__APPLE__)
+#define MEMORY_MMAP
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #define LOG_MEMORY_USAGE 0
 
 #define MAX_MEM_PTR	0x400 // more than 1024 malloc calls should be insane...
@@ -13,6 +19,40 @@
 static UINT8 *memptr[MAX_MEM_PTR]; // pointer to allocated memory
 static INT32 memsize[MAX_MEM_PTR];
 static INT32 mem_allocated;
+static size_t memmapped[MAX_MEM_PTR]; // length of the mapping for big blocks, 0 for malloc'd ones
+
+// big blocks (rom regions) get pages of their own, so the rom loader and the decoded rom
+// cache can map files straight into them (see BurnMallocMapped()) without touching the heap
+static UINT8 *MemAlloc(INT32 size, size_t *mapped)
+{
+	*mapped = 0;
+
+#ifdef MEMORY_MMAP
+	if (size >= 0x100000) {
+		size_t page = sysconf(_SC_PAGESIZE);
+		size_t len = (size + page - 1) & ~(page - 1);
+		void *ptr = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (ptr == MAP_FAILED) return NULL;
+
+		*mapped = len;
+		return (UINT8*)ptr;
+	}
+#endif
+
+	return (UINT8*)malloc(size);
+}
+
+static void MemFree(void *ptr, size_t mapped)
+{
+#ifdef MEMORY_MMAP
+	if (mapped) {
+		munmap(ptr, mapped); // also drops whatever files were mapped into it
+		return;
+	}
+#endif
+
+	free (ptr);
+}
 
 // this should be called early on... BurnDrvInit?
 
@@ -20,6 +60,7 @@ void BurnInitMemoryManager()
 {
 	memset (memptr, 0, sizeof(memptr));
 	memset (memsize, 0, sizeof(memsize));
+	memset (memmapped, 0, sizeof(memmapped));
 	mem_allocated = 0;
 }
 
@@ -29,7 +70,7 @@ UINT8 *_BurnMalloc(INT32 size, char *file, INT32 line)
 	for (INT32 i = 0; i < MAX_MEM_PTR; i++)
 	{
 		if (memptr[i] == NULL) {
-			memptr[i] = (UINT8*)malloc(size);
+			memptr[i] = MemAlloc(size, &memmapped[i]);
 
 			if (memptr[i] == NULL) {
 				bprintf (0, _T("BurnMalloc failed to allocate %d bytes of memory!\n"), size);
@@ -61,6 +102,16 @@ UINT8 *BurnRealloc(void *ptr, INT32 size)
 	for (INT32 i = 0; i < MAX_MEM_PTR; i++)
 	{
 		if (memptr[i] == mptr) {
+			if (memmapped[i] || size >= 0x100000) {
+				size_t mapped;
+				UINT8 *newptr = MemAlloc(size, &mapped);
+				if (newptr == NULL) return NULL;
+
+				memcpy(newptr, mptr, (memsize[i] < size) ? memsize[i] : size);
+				MemFree(mptr, memmapped[i]);
+				memptr[i] = newptr;
+				memmapped[i] = mapped;
+			} else
 			memptr[i] = (UINT8*)realloc(ptr, size);
 			mem_allocated -= memsize[i];
 			mem_allocated += size;
@@ -80,8 +131,9 @@ void _BurnFree(void *ptr)
 	for (INT32 i = 0; i < MAX_MEM_PTR; i++)
 	{
 		if (mptr != NULL && memptr[i] == mptr) {
-			free (memptr[i]);
+			MemFree(memptr[i], memmapped[i]);
 			memptr[i] = NULL;
+			memmapped[i] = 0;
 
 			mem_allocated -= memsize[i];
 			memsize[i] = 0;
@@ -93,6 +145,23 @@ void _BurnFree(void *ptr)
 	}
 }
 
+// Returns 1 when nLen bytes at ptr lie inside a big block from BurnMalloc() (pages of our own,
+// mmap'd), so whole pages of it may be replaced with MAP_FIXED file mappings.  Anything else
+// (malloc'd memory, static or stack buffers) has to be read into.
+INT32 BurnMallocMapped(const void *ptr, INT32 nLen)
+{
+	const UINT8 *mptr = (const UINT8*)ptr;
+
+	for (INT32 i = 0; i < MAX_MEM_PTR; i++)
+	{
+		if (memmapped[i] && mptr >= memptr[i] && nLen >= 0 && mptr + nLen <= memptr[i] + memsize[i]) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
 // call in BurnDrvExit?
 
 void BurnExitMemoryManager()
@@ -103,8 +172,9 @@ void BurnExitMemoryManager()
 #if defined FBNEO_DEBUG
 			bprintf(PRINT_ERROR, _T("BurnExitMemoryManager had to free mem pointer %i (%d bytes)\n"), i, memsize[i]);
 #endif
-			free (memptr[i]);
+			MemFree(memptr[i], memmapped[i]);
 			memptr[i] = NULL;
+			memmapped[i] = 0;
 
 			mem_allocated -= memsize[i];
 			memsize[i] = 0;
@@ -0,0 +1,191 @@
+// FB Neo startup profiler, see burn_profile.h
+
+#include "burnint.h"
+#include "burn_profile.h"
+#include "burn_thread.h"
+
+#if defined BURN_THREADS
+#include <chrono>
+#include <thread>
+#else
+#include <time.h>
+#endif
+
+#define MAX_PROFILE_PHASES	64
+#define MAX_PROFILE_DEPTH	32
+
+struct ProfilePhase {
+	const char *szName;
+	INT64 nTime;			// own time, ns
+	INT32 nCalls;
+};
+
+struct ProfileFrame {
+	INT32 nPhase;
+	INT64 nStart;
+	INT64 nChildren;		// time spent in the phases opened inside this one
+};
+
+static ProfilePhase Phases[MAX_PROFILE_PHASES];
+static INT32 nPhases = 0;
+
+static ProfileFrame Stack[MAX_PROFILE_DEPTH];
+static INT32 nDepth = 0;
+static INT32 nLost = 0;		// phases opened past MAX_PROFILE_DEPTH
+
+static INT32 nStarts = 0;
+static INT64 nProfileStart = 0;
+static const char *szProfileTitle = NULL;
+#if defined BURN_THREADS
+static std::thread::id ProfileThread;
+
+static inline INT64 ProfileNow()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static inline bool ProfileOnThread()
+{
+	return std::this_thread::get_id() == ProfileThread;
+}
+
+static inline void ProfileSetThread()
+{
+	ProfileThread = std::this_thread::get_id();
+}
+#else
+// no C++11 (VS2003 xbox1, VS2010 360): coarser clock, and no worker threads to tell apart
+static inline INT64 ProfileNow()
+{
+	return (INT64)clock() * 1000000000 / CLOCKS_PER_SEC;
+}
+
+static inline bool ProfileOnThread()
+{
+	return true;
+}
+
+static inline void ProfileSetThread()
+{
+}
+#endif
+
+static inline bool ProfileActive()
+{
+	return nStarts && ProfileOnThread();
+}
+
+static INT32 ProfileFind(const char *szPhase)
+{
+	for (INT32 i = 0; i < nPhases; i++) {
+		if (Phases[i].szName == szPhase || strcmp(Phases[i].szName, szPhase) == 0) return i;
+	}
+
+	if (nPhases == MAX_PROFILE_PHASES) return -1;
+
+	Phases[nPhases].szName = szPhase;
+	Phases[nPhases].nTime = 0;
+	Phases[nPhases].nCalls = 0;
+
+	return nPhases++;
+}
+
+void BurnProfileBegin(const char *szPhase)
+{
+	if (!ProfileActive()) return;
+
+	if (nDepth == MAX_PROFILE_DEPTH) {
+		nLost++;
+		return;
+	}
+
+	ProfileFrame *f = &Stack[nDepth++];
+	f->nPhase = ProfileFind(szPhase);
+	f->nChildren = 0;
+	f->nStart = ProfileNow();
+}
+
+void BurnProfileEnd()
+{
+	if (!ProfileActive()) return;
+
+	if (nLost) {
+		nLost--;
+		return;
+	}
+
+	if (nDepth == 0) return;
+
+	ProfileFrame *f = &Stack[--nDepth];
+	INT64 nTime = ProfileNow() - f->nStart;
+
+	if (f->nPhase >= 0) {
+		Phases[f->nPhase].nTime += nTime - f->nChildren;
+		Phases[f->nPhase].nCalls++;
+	}
+
+	if (nDepth) Stack[nDepth - 1].nChildren += nTime;
+}
+
+static void ProfileReport(INT64 nTotal)
+{
+	INT32 nOrder[MAX_PROFILE_PHASES];
+	INT64 nPhaseTotal = 0;
+
+	for (INT32 i = 0; i < nPhases; i++) {
+		INT32 j = i;
+
+		for (; j > 0 && Phases[nOrder[j - 1]].nTime < Phases[i].nTime; j--) {
+			nOrder[j] = nOrder[j - 1];
+		}
+		nOrder[j] = i;
+
+		nPhaseTotal += Phases[i].nTime;
+	}
+
+	bprintf(PRINT_IMPORTANT, _T("*** Startup profile for %hs: %.1f ms\n"), szProfileTitle, nTotal / 1e6);
+
+	for (INT32 i = 0; i < nPhases; i++) {
+		ProfilePhase *p = &Phases[nOrder[i]];
+
+		bprintf(PRINT_IMPORTANT, _T("    %-20hs %9.1f ms %5.1f%% %6d call%hs\n"), p->szName, p->nTime / 1e6, nTotal ? p->nTime * 100.0 / nTotal : 0.0, p->nCalls, (p->nCalls == 1) ? "" : "s");
+	}
+
+	// whatever ran outside of any phase (frontend, driver code between the hooks)
+	bprintf(PRINT_IMPORTANT, _T("    %-20hs %9.1f ms %5.1f%%\n"), "(other)", (nTotal - nPhaseTotal) / 1e6, nTotal ? (nTotal - nPhaseTotal) * 100.0 / nTotal : 0.0);
+}
+
+void BurnProfileStart(const char *szTitle)
+{
+	if (nStarts) {
+		if (ProfileOnThread()) nStarts++;
+		return;
+	}
+
+	if (!bBurnProfileStartup) return;
+
+	nPhases = 0;
+	nDepth = 0;
+	nLost = 0;
+	szProfileTitle = szTitle;
+	ProfileSetThread();
+	nProfileStart = ProfileNow();
+	nStarts = 1;
+}
+
+void BurnProfileStop()
+{
+	if (!ProfileActive()) return;
+
+	if (--nStarts) return;
+
+	INT64 nTotal = ProfileNow() - nProfileStart;
+
+	// close anything a failed init left open
+	nStarts = 1;
+	nLost = 0;
+	while (nDepth) BurnProfileEnd();
+	nStarts = 0;
+
+	ProfileReport(nTotal);
+}
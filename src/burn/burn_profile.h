@@ -0,0 +1,34 @@
+// Startup profiler
+//
+// With bBurnProfileStartup set, the time spent starting a game (archive open, rom
+// inflate and copies, decryption, GfxDecode, sound table and cpu init) is broken down
+// into phases and printed ranked, slowest first, once the game is up.  Phases nest and
+// each one is only charged its own time, not that of the phases opened inside it, so
+// BurnLoadRom() shows the copying and interleaving while the inflate underneath it is
+// listed on its own.  While no profile is running the calls return straight away.
+//
+// Only the thread that started the profile is timed, phases opened on other threads
+// are ignored.
+
+#ifndef _BURN_PROFILE_H
+#define _BURN_PROFILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// start a profile titled szTitle (kept by pointer), starts made while one is running are folded into it
+void BurnProfileStart(const char *szTitle);
+
+// stop it, the report is printed when the outermost start is stopped
+void BurnProfileStop();
+
+// open / close a phase, szPhase is kept by pointer so it must be a string literal
+void BurnProfileBegin(const char *szPhase);
+void BurnProfileEnd();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
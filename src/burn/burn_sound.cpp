@@ -2,26 +2,36 @@
 #include "burn_sound.h"
 #include "timer.h"
 
-INT16 Precalc[4096 * 4];
+// Table used for interpolation, worked out by the compiler so it's read-only data
+// (shared between processes, nothing to do at startup)
+template <INT32 a> struct Precalc4p {
+	enum {
+		x  = a  * 4,			// x = 0..16384
+		x2 = x  * x / 16384,	// pow(x, 2);
+		x3 = x2 * x / 16384		// pow(x, 3);
+	};
+};
 
-// Routine used to precalculate the table used for interpolation
-INT32 cmc_4p_Precalc()
-{
-	INT32 a, x, x2, x3;
-
-	for (a = 0; a < 4096; a++) {
-		x  = a  * 4;			// x = 0..16384
-		x2 = x  * x / 16384;	// pow(x, 2);
-		x3 = x2 * x / 16384;	// pow(x, 3);
+#define PRECALC(a)		(INT16)(-Precalc4p<a>::x / 3 + Precalc4p<a>::x2 / 2 - Precalc4p<a>::x3 / 6),			\
+						(INT16)(-Precalc4p<a>::x / 2 - Precalc4p<a>::x2     + Precalc4p<a>::x3 / 2 + 16384),	\
+						(INT16)( Precalc4p<a>::x     + Precalc4p<a>::x2 / 2 - Precalc4p<a>::x3 / 2),			\
+						(INT16)(-Precalc4p<a>::x / 6 + Precalc4p<a>::x3 / 6)
+#define PRECALC_4(a)	PRECALC(a), PRECALC(a + 1), PRECALC(a + 2), PRECALC(a + 3)
+#define PRECALC_16(a)	PRECALC_4(a), PRECALC_4(a + 4), PRECALC_4(a + 8), PRECALC_4(a + 12)
+#define PRECALC_64(a)	PRECALC_16(a), PRECALC_16(a + 16), PRECALC_16(a + 32), PRECALC_16(a + 48)
+#define PRECALC_256(a)	PRECALC_64(a), PRECALC_64(a + 64), PRECALC_64(a + 128), PRECALC_64(a + 192)
+#define PRECALC_1024(a)	PRECALC_256(a), PRECALC_256(a + 256), PRECALC_256(a + 512), PRECALC_256(a + 768)
 
-		Precalc[a * 4 + 0] = (INT16)(-x / 3 + x2 / 2 - x3 / 6);
-		Precalc[a * 4 + 1] = (INT16)(-x / 2 - x2     + x3 / 2 + 16384);
-		Precalc[a * 4 + 2] = (INT16)( x     + x2 / 2 - x3 / 2);
-		Precalc[a * 4 + 3] = (INT16)(-x / 6 + x3 / 6);
-	}
+extern "C" const INT16 Precalc[4096 * 4] = {
+	PRECALC_1024(0), PRECALC_1024(1024), PRECALC_1024(2048), PRECALC_1024(3072)
+};
 
-	return 0;
-}
+#undef PRECALC_1024
+#undef PRECALC_256
+#undef PRECALC_64
+#undef PRECALC_16
+#undef PRECALC_4
+#undef PRECALC
 
 static INT16 dac_lastin_r  = 0;
 static INT16 dac_lastout_r = 0;
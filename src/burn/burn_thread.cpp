@@ -0,0 +1,155 @@
+// FBNeo worker pool, see burn_thread.h
+
+#include "burnint.h"
+#include "burn_thread.h"
+
+#if defined BURN_THREADS
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+#define MAX_BURN_THREADS	16
+
+static std::thread *Workers[MAX_BURN_THREADS];
+static INT32 nWorkers = 0;
+
+static std::mutex JobMutex;
+static std::condition_variable JobStart;
+static std::condition_variable JobDone;
+
+static BurnThreadJob pCurrentJob = NULL;
+static void *pCurrentParam = NULL;
+static INT32 nCurrentCount = 0;
+static std::atomic<INT32> nNextIndex(0);
+static INT32 nBusyWorkers = 0;
+static UINT32 nGeneration = 0;
+static bool bQuit = false;
+
+static void BurnThreadDrain(BurnThreadJob pJob, INT32 nCount, void *pParam)
+{
+	for (;;) {
+		INT32 i = nNextIndex.fetch_add(1);
+		if (i >= nCount) break;
+
+		pJob(i, pParam);
+	}
+}
+
+static void BurnThreadWorker(UINT32 nSeen)
+{
+	for (;;) {
+		BurnThreadJob pJob;
+		void *pParam;
+		INT32 nCount;
+
+		{
+			std::unique_lock<std::mutex> lock(JobMutex);
+			JobStart.wait(lock, [&] { return bQuit || nGeneration != nSeen; });
+			if (bQuit) return;
+
+			nSeen = nGeneration;
+			pJob = pCurrentJob;
+			pParam = pCurrentParam;
+			nCount = nCurrentCount;
+		}
+
+		BurnThreadDrain(pJob, nCount, pParam);
+
+		{
+			std::lock_guard<std::mutex> lock(JobMutex);
+			if (--nBusyWorkers == 0) JobDone.notify_one();
+		}
+	}
+}
+
+static void BurnThreadStart(INT32 nThreads)
+{
+	BurnThreadExit();
+
+	bQuit = false;
+	for (INT32 i = 0; i < nThreads - 1; i++) {
+		Workers[nWorkers++] = new std::thread(BurnThreadWorker, nGeneration);	// only jobs posted from now on
+	}
+}
+
+INT32 BurnThreadCount()
+{
+	INT32 nThreads = nBurnThreads;
+	if (nThreads > MAX_BURN_THREADS) nThreads = MAX_BURN_THREADS;
+
+	return (nThreads > 1) ? nThreads : 1;
+}
+
+void BurnThreadRun(BurnThreadJob pJob, INT32 nCount, void *pParam)
+{
+	INT32 nThreads = BurnThreadCount();
+
+	if (nThreads <= 1 || nCount <= 1) {
+		for (INT32 i = 0; i < nCount; i++) {
+			pJob(i, pParam);
+		}
+		return;
+	}
+
+	if (nWorkers != nThreads - 1) {
+		BurnThreadStart(nThreads);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(JobMutex);
+		pCurrentJob = pJob;
+		pCurrentParam = pParam;
+		nCurrentCount = nCount;
+		nNextIndex.store(0);
+		nBusyWorkers = nWorkers;
+		nGeneration++;
+	}
+	JobStart.notify_all();
+
+	BurnThreadDrain(pJob, nCount, pParam);	// help out instead of waiting idle
+
+	std::unique_lock<std::mutex> lock(JobMutex);
+	JobDone.wait(lock, [] { return nBusyWorkers == 0; });
+}
+
+void BurnThreadExit()
+{
+	if (nWorkers == 0) return;
+
+	{
+		std::lock_guard<std::mutex> lock(JobMutex);
+		bQuit = true;
+	}
+	JobStart.notify_all();
+
+	for (INT32 i = 0; i < nWorkers; i++) {
+		Workers[i]->join();
+		delete Workers[i];
+		Workers[i] = NULL;
+	}
+
+	nWorkers = 0;
+	bQuit = false;
+}
+
+#else
+
+INT32 BurnThreadCount()
+{
+	return 1;
+}
+
+void BurnThreadRun(BurnThreadJob pJob, INT32 nCount, void *pParam)
+{
+	for (INT32 i = 0; i < nCount; i++) {
+		pJob(i, pParam);
+	}
+}
+
+void BurnThreadExit()
+{
+}
+
+#endif
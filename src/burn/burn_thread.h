@@ -0,0 +1,25 @@
+// Persistent worker pool for the opt-in parallel renderers
+//
+// The threads are started on first use and parked between jobs, so a frame
+// only costs a wake-up.  Work items are handed out through a shared counter:
+// every worker (and the calling thread, which always helps) grabs the next
+// free index until none are left, so a slow band never holds up the others.
+
+// The pool needs C++11 threads.  Older toolchains (VS2003 for xbox1, VS2010 for the 360)
+// don't have them, there BurnThreadCount() is always 1 and BurnThreadRun() runs the jobs
+// one after the other on the calling thread.
+#if __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#define BURN_THREADS
+#endif
+
+// job callback, nIndex is 0 .. nCount - 1
+typedef void (*BurnThreadJob)(INT32 nIndex, void *pParam);
+
+// number of threads (including the caller) BurnThreadRun() will use, 1 when nBurnThreads is off
+INT32 BurnThreadCount();
+
+// run pJob(0 .. nCount - 1, pParam) across the pool and wait for all of them
+void BurnThreadRun(BurnThreadJob pJob, INT32 nCount, void *pParam);
+
+// stop and join the workers (called in BurnLibExit)
+void BurnThreadExit();
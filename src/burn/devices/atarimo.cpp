@@ -917,6 +917,7 @@ if ((temp & 0xff00) == 0xc800)
 				// 1. set clipping to this sprite's bandclip:
 				GenericTilesSetClip(cliprect->min_x, cliprect->max_x, cliprect->min_y, (cliprect->max_y+1 > nScreenHeight) ? nScreenHeight : cliprect->max_y+1);
 				// 2: draw sprite:
+				GenericGfxCheckTile(gfx, code);
 				DrawCustomMaskTile(bitmap, gfx->width, gfx->height, code, sx, sy, hflip, vflip, color, 0, mo->transpen, 0, gfx->gfxbase);
 				// 3: set clipping back to cached value @ AtariMoRender()
 				GenericTilesSetClip(mainclippy.min_x, mainclippy.max_x, mainclippy.min_y, mainclippy.max_y);
@@ -957,6 +958,7 @@ if ((temp & 0xff00) == 0xc800)
 
 				/* draw the sprite */
 				GenericTilesSetClip(cliprect->min_x, cliprect->max_x, cliprect->min_y, (cliprect->max_y+1 > nScreenHeight) ? nScreenHeight : cliprect->max_y+1);
+				GenericGfxCheckTile(gfx, code);
 				DrawCustomMaskTile(bitmap, gfx->width, gfx->height, code, sx, sy, hflip, vflip, color, 0, mo->transpen, 0, gfx->gfxbase);
 				GenericTilesSetClip(mainclippy.min_x, mainclippy.max_x, mainclippy.min_y, mainclippy.max_y);
 				rendered = 1;
@@ -120,9 +120,14 @@ the decryption keys.
 #if 1
 #include "cps.h"
 #include "bitswap.h"
+#include "burn_cache.h"
+#include "burn_profile.h"
 
 #define BIT(x,n) (((x)>>(n))&1)
 #define BITSWAP8(a, b, c, d, e, f, g, h, i) BITSWAP08(a, b, c, d, e, f, g, h, i)
+
+// version of the cached decrypted code (burn_cache.h), bump when the decryption changes
+#define CPS2_CACHE_VERSION 1
 #endif
 
 
@@ -647,6 +652,11 @@ static void cps2_decrypt(const UINT32 *master_key, UINT32 lower_limit, UINT32 up
 	nCpsCodeLen = length;
 	UINT16 *dec = (UINT16*)CpsCode;
 
+	// decrypted by a previous start (the key ROM is part of the cache key)
+	if (BurnCacheLoad("code", CPS2_CACHE_VERSION, CpsCode, length) == 0) return;
+
+	BurnProfileBegin("decrypt");
+
 	INT32 i;
 	UINT32 key1[4];
 	struct optimised_sbox sboxes1[4*4];
@@ -736,6 +746,11 @@ static void cps2_decrypt(const UINT32 *master_key, UINT32 lower_limit, UINT32 up
 			}
 		}
 	}
+
+	BurnProfileEnd();
+
+	BurnCacheSave("code", CPS2_CACHE_VERSION, CpsCode, length);
+
 #if 0
 	memory_set_decrypted_region(0, 0x000000, length - 1, dec);
 	m68k_set_encrypted_opcode_range(0,0,length);
@@ -18,8 +18,183 @@ static inline UINT32 alpha_blend(UINT32 d, UINT32 s, UINT32 p)
 		((((s & 0x00ff00) * p) + ((d & 0x00ff00) * a)) & 0x00ff0000)) >> 8;
 }
 
-// Include all tile variants:
-#include "ctv.h"
+// Template parameters of the tile variants:
+// nBpp   is 2 3 4 bytes per pixel
+// nSize  is 8, 16 or 32
+// nRows  is 1 to shift output based on CpstRowShift
+// nCare  is 1 to clip output based on nCtvRollX/Y
+// nFlipX is 1 to flip the tile horizontally
+// nMask  is 1 for CPS2 Sprite Masking, 2 for CPS1 BgHi
+
+// Blend colour c into pPix (24/32-bit), kept out of line so CtvPlot() stays small enough to
+// be inlined everywhere, only a few games set nCpsBlend
+template <INT32 nBpp>
+static void CtvPlotBlend(UINT8 *pPix, UINT32 c)
+{
+	if (nBpp == 3) {
+		c = alpha_blend(pPix[0]|(pPix[1]<<8)|(pPix[2]<<16), c, nCpsBlend);
+		pPix[0] = (UINT8)c; pPix[1] = (UINT8)(c>>8); pPix[2] = (UINT8)(c>>16);
+	} else {
+		*((UINT32 *)pPix) = alpha_blend(*((UINT32 *)pPix), c, nCpsBlend);
+	}
+}
+
+// Plot colour c at pPix
+template <INT32 nBpp, INT32 nMask>
+static inline void CtvPlot(UINT8 *pPix, UINT16 *pPixZ, UINT32 c)
+{
+	if (nMask == 1 && *pPixZ >= ZValue) return;
+
+	if (nBpp == 2) {
+		*((UINT16 *)pPix) = (UINT16)c;
+	} else if (nCpsBlend) {
+		CtvPlotBlend<nBpp>(pPix, c);
+	} else if (nBpp == 3) {
+		pPix[0] = (UINT8)c; pPix[1] = (UINT8)(c>>8); pPix[2] = (UINT8)(c>>16);
+	} else {
+		*((UINT32 *)pPix) = c;
+	}
+
+	if (nMask == 1 && nBpp != 3) *pPixZ = ZValue;	// 24-bit never wrote the z buffer, kept that way
+}
+
+// Store colour c as pixel i of pPix
+template <INT32 nBpp>
+static inline void CtvPut(UINT8 *pPix, INT32 i, UINT32 c)
+{
+	if (nBpp == 2) {
+		((UINT16 *)pPix)[i] = (UINT16)c;
+	} else if (nBpp == 3) {
+		pPix[i*3+0] = (UINT8)c; pPix[i*3+1] = (UINT8)(c>>8); pPix[i*3+2] = (UINT8)(c>>16);
+	} else {
+		((UINT32 *)pPix)[i] = c;
+	}
+}
+
+// Draw eight bit-packed pixels b, (msb) AAAABBBB CCCCDDDD EEEEFFFF GGGGHHHH (lsb)
+// bOpaque is set when a fully opaque group may be stored without per-pixel tests
+template <INT32 nBpp, INT32 nCare, INT32 nFlipX, INT32 nMask>
+static inline void CtvDraw8(UINT32 b, UINT8 *&pPix, UINT16 *&pPixZ, UINT32 &rx, const UINT32 *ctp, bool bOpaque)
+{
+	if (b == 0) {
+		// Nothing to plot in this group
+		pPix += 8 * nBpp;
+		if (nMask == 1) pPixZ += 8;
+		if (nCare) rx += 8 * 0x7fff;
+		return;
+	}
+
+	// No zero nibble and (when clipping) both ends of the group on screen: plot all eight
+	if (nMask == 0 && bOpaque && ((b - 0x11111111) & ~b & 0x88888888) == 0 &&
+		(nCare == 0 || ((rx | (rx + 7 * 0x7fff)) & 0x20004000) == 0))
+	{
+		CtvPut<nBpp>(pPix, 0, ctp[(b >> (nFlipX ?  0 : 28)) & 15]);
+		CtvPut<nBpp>(pPix, 1, ctp[(b >> (nFlipX ?  4 : 24)) & 15]);
+		CtvPut<nBpp>(pPix, 2, ctp[(b >> (nFlipX ?  8 : 20)) & 15]);
+		CtvPut<nBpp>(pPix, 3, ctp[(b >> (nFlipX ? 12 : 16)) & 15]);
+		CtvPut<nBpp>(pPix, 4, ctp[(b >> (nFlipX ? 16 : 12)) & 15]);
+		CtvPut<nBpp>(pPix, 5, ctp[(b >> (nFlipX ? 20 :  8)) & 15]);
+		CtvPut<nBpp>(pPix, 6, ctp[(b >> (nFlipX ? 24 :  4)) & 15]);
+		CtvPut<nBpp>(pPix, 7, ctp[(b >> (nFlipX ? 28 :  0)) & 15]);
+
+		pPix += 8 * nBpp;
+		if (nCare) rx += 8 * 0x7fff;
+		return;
+	}
+
+#define DO_PIX																				\
+	if (nCare == 0 || (rx & 0x20004000) == 0) {												\
+		UINT32 c = nFlipX ? (b & 15) : (b >> 28);											\
+		if (nMask == 2) {																	\
+			if (c && CpstPmsk & (1 << (c ^ 15))) CtvPlot<nBpp, nMask>(pPix, pPixZ, ctp[c]);	\
+		} else {																			\
+			if (c) CtvPlot<nBpp, nMask>(pPix, pPixZ, ctp[c]);								\
+		}																					\
+	}																						\
+	if (nFlipX) b >>= 4; else b <<= 4;														\
+	pPix += nBpp;																			\
+	if (nMask == 1) pPixZ++;																\
+	if (nCare) rx += 0x7fff;
+
+	// Written out eight times, the loop isn't reliably unrolled at -O2
+	DO_PIX DO_PIX DO_PIX DO_PIX DO_PIX DO_PIX DO_PIX DO_PIX
+
+#undef DO_PIX
+}
+
+// Draw a nxn tile
+// pCtvLine, pCtvTile, nCtvTileAdd are defined
+template <INT32 nBpp, INT32 nSize, INT32 nRows, INT32 nCare, INT32 nFlipX, INT32 nMask>
+static INT32 CtvDo()
+{
+	// Invalid combination of capabilities, never selected by cpst.cpp
+	if (nSize != 8 && nSize != 16 && nSize != 32) return 0;
+	if (nRows && (nSize != 16 || nMask == 1)) return 0;
+
+	const UINT32 *ctp = CpstPal;
+	INT16 *Rows = CpstRowShift;
+	UINT32 nBlank = 0;
+	bool bOpaque = (nBpp == 2 || nCpsBlend == 0);
+
+	for (INT32 y = 0; y < nSize; y++) {
+		bool bLine = true;
+
+		if (nCare) {
+			bLine = (nCtvRollY & 0x20004000) == 0;	// okay to plot line
+			nCtvRollY += 0x7fff;
+		}
+
+		if (bLine) {
+			UINT8 *pPix = pCtvLine;
+			UINT16 *pPixZ = pZVal;
+			UINT32 rx = nCtvRollX;
+
+			if (nRows) {
+				if (nMask == 1) pPixZ += Rows[0];
+				pPix += Rows[0] * nBpp;
+				if (nCare) rx += Rows[0] * 0x7fff;
+			}
+
+			for (INT32 i = 0; i < nSize / 8; i++) {
+				UINT32 b = ((UINT32 *)pCtvTile)[nFlipX ? (nSize / 8 - 1 - i) : i];
+				nBlank |= b;
+
+				CtvDraw8<nBpp, nCare, nFlipX, nMask>(b, pPix, pPixZ, rx, ctp, bOpaque);
+			}
+		}
+
+		pCtvLine += nBurnPitch;
+		pCtvTile += nCtvTileAdd;
+		if (nRows) Rows++;
+		if (nMask == 1) pZVal += 384;
+	}
+
+	return nBlank == 0;
+}
+
+// Lookup tables, indexed by nCpstType & 0x1e | flipx
+#define CTV_FOUR(b, s, r, m)	CtvDo<b, s, r, 0, 0, m>, CtvDo<b, s, r, 0, 1, m>, CtvDo<b, s, r, 1, 0, m>, CtvDo<b, s, r, 1, 1, m>
+#define CTV_SIZE(b, s, m)		CTV_FOUR(b, s, 0, m), CTV_FOUR(b, s, 1, m)
+#define CTV_TABLE(b, m)			{ CTV_SIZE(b, 8, m), CTV_SIZE(b, 16, m), CTV_SIZE(b, 24, m), CTV_SIZE(b, 32, m) }
+
+static CtvDoFn CtvDo2[0x20]  = CTV_TABLE(2, 0);
+static CtvDoFn CtvDo2m[0x20] = CTV_TABLE(2, 1);
+static CtvDoFn CtvDo2b[0x20] = CTV_TABLE(2, 2);
+static CtvDoFn CtvDo3[0x20]  = CTV_TABLE(3, 0);
+static CtvDoFn CtvDo3m[0x20] = CTV_TABLE(3, 1);
+static CtvDoFn CtvDo3b[0x20] = CTV_TABLE(3, 2);
+static CtvDoFn CtvDo4[0x20]  = CTV_TABLE(4, 0);
+static CtvDoFn CtvDo4m[0x20] = CTV_TABLE(4, 1);
+static CtvDoFn CtvDo4b[0x20] = CTV_TABLE(4, 2);
+
+#undef CTV_TABLE
+#undef CTV_SIZE
+#undef CTV_FOUR
+
+// Current BPP:
+CtvDoFn CtvDoX[0x20];
+CtvDoFn CtvDoXM[0x20];
+CtvDoFn CtvDoXB[0x20];
 
 static INT32 nLastBpp=0;
 INT32 CtvReady()
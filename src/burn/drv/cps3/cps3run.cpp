@@ -21,12 +21,17 @@ Port to FBA by OopsWare
 
 #include "cps3.h"
 #include "sh2_intf.h"
+#include "burn_cache.h"
+#include "burn_profile.h"
 
 #define	BE_GFX		1
 #define BE_GFX_CRAM 0   // do not touch!
 //#define	FAST_BOOT	1
 #define SPEED_HACK	1		// Default should be 1, if not FPS would drop.
 
+// version of the cached program/data roms (burn_cache.h), bump when their loading or decryption changes
+#define CPS3_CACHE_VERSION	1
+
 static UINT8 *Mem = NULL, *MemEnd = NULL;
 static UINT8 *RamStart, *RamEnd;
 
@@ -1163,11 +1168,17 @@ INT32 cps3Init()
 #ifdef LSB_FIRST
 	be_to_le( RomBios, 0x080000 );
 #endif
+	BurnProfileBegin("decrypt");
 	cps3_decrypt_bios();
+	BurnProfileEnd();
+
+	// the program roms and their decrypted copy (RomGame_D follows RomGame) come from
+	// the cache when possible
+	bool bCached = (BurnCacheLoad("prg", CPS3_CACHE_VERSION, RomGame, 0x2000000) == 0);
 
 	// load and decode sh-2 program roms
 	ii = 0;	offset = 0;
-	while (BurnDrvGetRomInfo(&pri, ii) == 0) {
+	while (!bCached && BurnDrvGetRomInfo(&pri, ii) == 0) {
 		if (pri.nType & BRF_PRG) {
 			if (pri.nLen == 0x800000) // sfiii4n
 			{
@@ -1188,14 +1199,22 @@ INT32 cps3Init()
 			ii++;
 		}
 	}
+	if (!bCached) {
 #ifdef LSB_FIRST
-	be_to_le( RomGame, 0x1000000 );
+		be_to_le( RomGame, 0x1000000 );
 #endif
-	cps3_decrypt_game();
+		BurnProfileBegin("decrypt");
+		cps3_decrypt_game();
+		BurnProfileEnd();
+
+		BurnCacheSave("prg", CPS3_CACHE_VERSION, RomGame, 0x2000000);
+	}
 	
-	// load graphic and sound roms
+	// load graphic and sound roms (CHD games have none, nothing to cache)
+	bCached = (BurnCacheLoad("user", CPS3_CACHE_VERSION, RomUser, cps3_data_rom_size) == 0);
+
 	ii = 0;	offset = 0;
-	while (BurnDrvGetRomInfo(&pri, ii) == 0) {
+	while (!bCached && BurnDrvGetRomInfo(&pri, ii) == 0) {
 		if (pri.nType & (BRF_GRA | BRF_SND)) {
 			if (pri.nLen == 0x800000) // sfiii4n
 			{
@@ -1215,6 +1234,10 @@ INT32 cps3Init()
 		}
 	}
 
+	if (!bCached && offset) {
+		BurnCacheSave("user", CPS3_CACHE_VERSION, RomUser, cps3_data_rom_size);
+	}
+
 	{
 		Sh2Init(1);
 		Sh2Open(0);
@@ -4,6 +4,14 @@
 #include "tiles_generic.h"
 #include "konamiic.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define K053936_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define K053936_NEON
+#include <arm_neon.h>
+#endif
+
 #define MAX_K053936	2
 
 static INT32 nRamLen[MAX_K053936] = { 0, 0 };
@@ -227,185 +235,221 @@ void K053936PredrawTiles(INT32 chip, UINT8 *gfx, INT32 transparent, INT32 tcol)
 	}
 }
 
-static inline void copy_roz32(INT32 chip, INT32 minx, INT32 maxx, INT32 miny, INT32 maxy, UINT32 startx, UINT32 starty, INT32 incxx, INT32 incxy, INT32 incyx, INT32 incyy, INT32 transp, INT32 priority)
+// The roz copies work on whole spans rather than single pixels: a line's source
+// coordinates are stepped incrementally, and with wrap disabled the part of the line
+// that lands on the source page is found once up front instead of testing every pixel.
+
+// Narrow [*k0, *k1) to the pixels k of a line with 0 <= (INT32)(c + k * inc) < lim,
+// returns 1 (nothing narrowed) when the coordinate overflows 32 bits inside the line
+static INT32 roz_span_clip(UINT32 c, INT32 inc, INT32 lim, INT32 n, INT32 *k0, INT32 *k1)
 {
-	if (incxx == (1 << 16) && incxy == 0 && incyx == 0 && incyy == (1 << 16) && K053936Wrap[chip])
-	{
-		INT32 scrollx = startx >> 16;
-		INT32 scrolly = starty >> 16;
+	INT64 s = (INT32)c;
+	INT64 e = s + (INT64)inc * (n - 1);
+
+	if (e < -0x80000000LL || e > 0x7fffffffLL) return 1;
+
+	INT64 lo, hi; // first and last pixel on the page
+
+	if (inc > 0) {
+		lo = (s >= 0) ? 0 : ((inc - 1 - s) / inc);
+		hi = (s >= lim) ? -1 : ((lim - 1 - s) / inc);
+	} else if (inc < 0) {
+		INT64 d = -(INT64)inc;
+		lo = (s < lim) ? 0 : ((s - lim + d) / d);
+		hi = (s < 0) ? -1 : (s / d);
+	} else {
+		lo = 0;
+		hi = (s >= 0 && s < lim) ? (n - 1) : -1;
+	}
+
+	if (lo > *k0) *k0 = (lo < n) ? (INT32)lo : n;
+	if (hi + 1 < *k1) *k1 = (INT32)(hi + 1);
+
+	return 0;
+}
+
+struct roz_source {
+	UINT16 *src;
+	UINT32 *pal;		// NULL for 16-bit indexed output
+	INT32 width;
+	INT32 wmask;
+	INT32 hmask;
+	INT32 tmask;		// pixel is skipped when (pxl & tmask) == tval
+	INT32 tval;
+	INT32 priority;
+};
+
+// the source fields are passed in by value, the stores to dst would otherwise force
+// them to be reloaded for every pixel
+template <typename T, INT32 nTransp>
+static inline void roz_plot(T *dst, UINT8 *pri, INT32 pxl, const UINT32 *pal, INT32 tmask, INT32 tval, UINT8 priority)
+{
+	if (sizeof(T) == 4) {
+		if (nTransp && (pxl & 0x8000)) return;
+
+		*dst = pal[pxl & 0x7fff];
+	} else {
+		if (nTransp && (pxl & tmask) == tval) return;
 
-		for (INT32 sy = 0; sy < nScreenHeight; sy++) {
-			UINT8  *pri = konami_priority_bitmap + (sy * nScreenWidth);
-			UINT16 *src = tscreen[chip] + (((scrolly + sy) % nHeight[chip]) * nWidth[chip]);
-			UINT32 *dst = konami_bitmap32 + (sy * nScreenWidth);
+		*dst = nTransp ? pxl : (pxl & 0x7fff);
+	}
+	*pri = priority;
+}
 
-			for (INT32 sx = 0; sx < nScreenWidth; sx++) {
-				INT32 pxl = src[(scrollx+sx)%nWidth[chip]];
-				if ((pxl & 0x8000)!=0 && transp) continue;
+// one line of n pixels, starting at source position cx, cy (16.16)
+template <typename T, INT32 nTransp, INT32 nWrap>
+static void roz_span(T *dst, UINT8 *pri, INT32 n, UINT32 cx, UINT32 cy, INT32 incxx, INT32 incxy, const roz_source *s)
+{
+	const UINT16 *src = s->src;
+	const UINT32 *pal = s->pal;
+	const INT32 width = s->width;
+	const INT32 tmask = s->tmask;
+	const INT32 tval = s->tval;
+	const UINT8 priority = s->priority;
+	const UINT32 wmask = s->wmask;
+	const UINT32 hmask = s->hmask;
+	const UINT32 dx = incxx;
+	const UINT32 dy = incxy;
+
+	INT32 k = 0, k1 = n;
+
+	if (nWrap == 0)
+	{
+		if (roz_span_clip(cx, incxx, width << 16, n, &k, &k1) || roz_span_clip(cy, incxy, (hmask + 1) << 16, n, &k, &k1))
+		{
+			// coordinates wrap around inside the line, check every pixel
+			for (k = 0; k < n; k++, cx += dx, cy += dy) {
+				if ((cx >> 16) > wmask || (cy >> 16) > hmask) continue;
 
-				dst[sx] = konami_palette32[pxl & 0x7fff];
-				pri[sx] = priority;
+				roz_plot<T, nTransp>(dst + k, pri + k, src[((cy >> 16) * width) + (cx >> 16)], pal, tmask, tval, priority);
 			}
+			return;
 		}
-		return;
+
+		cx += k * dx;
+		cy += k * dy;
 	}
 
-	UINT8  *pri = konami_priority_bitmap;
-	UINT32 *dst = konami_bitmap32;
-	UINT32 *pal = konami_palette32;
-	UINT16 *src = tscreen[chip];
+#define ROZ_PIXEL(x, y)	src[nWrap ? (((((y) >> 16) & hmask) * width) + (((x) >> 16) & wmask)) : ((((y) >> 16) * width) + ((x) >> 16))]
 
-	INT32 width = nWidth[chip];
-	INT32 hmask = nHeight[chip] - 1;
-	INT32 wmask = nWidth[chip] - 1;
+	// four at a time, so all the source reads go out before the stores
+	for (; k + 4 <= k1; k += 4, cx += dx * 4, cy += dy * 4) {
+		INT32 p0 = ROZ_PIXEL(cx, cy);
+		INT32 p1 = ROZ_PIXEL(cx + dx, cy + dy);
+		INT32 p2 = ROZ_PIXEL(cx + dx * 2, cy + dy * 2);
+		INT32 p3 = ROZ_PIXEL(cx + dx * 3, cy + dy * 3);
 
-	INT32 wrap = K053936Wrap[chip];
-	
-	dst += maxx * miny; // right?
-	
-	for (INT32 sy = miny; sy < maxy; sy++, startx+=incyx, starty+=incyy)
-	{
-		UINT32 cx = startx;
-		UINT32 cy = starty;
-
-		if (transp) {
-			if (wrap) {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++)
-				{
-					INT32 pxl = src[(((cy >> 16) & hmask) * width) + ((cx >> 16) & wmask)];
-		
-					if (!(pxl & 0x8000)) {
-						*dst = pal[pxl];
-						*pri = priority;
-					}
-				}
-			} else {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++)
-				{
-					INT32 yy = cy >> 16;
-					if (yy > hmask || yy < 0) continue;
-					INT32 xx = cx >> 16;
-					if (xx > wmask || xx < 0) continue;
-
-					INT32 pxl = src[(yy * width) + xx];
-
-					if (!(pxl & 0x8000)) {
-						*dst = pal[pxl];
-						*pri = priority;
-					}
-				}
-			}
-		} else {
-			if (wrap) {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++) {
-					*dst = pal[src[(((cy >> 16) & hmask) * width) + ((cx >> 16) & wmask)] & 0x7fff];
-					*pri = priority;
-				}
-			} else {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++) {
-					INT32 yy = cy >> 16;
-					if (yy > hmask || yy < 0) continue;
-					INT32 xx = cx >> 16;
-					if (xx > wmask || xx < 0) continue;
-
-					*dst = pal[src[(yy * width) + xx] & 0x7fff];
-					*pri = priority;
-				}
-			}
+		roz_plot<T, nTransp>(dst + k + 0, pri + k + 0, p0, pal, tmask, tval, priority);
+		roz_plot<T, nTransp>(dst + k + 1, pri + k + 1, p1, pal, tmask, tval, priority);
+		roz_plot<T, nTransp>(dst + k + 2, pri + k + 2, p2, pal, tmask, tval, priority);
+		roz_plot<T, nTransp>(dst + k + 3, pri + k + 3, p3, pal, tmask, tval, priority);
+	}
+
+	for (; k < k1; k++, cx += dx, cy += dy) {
+		roz_plot<T, nTransp>(dst + k, pri + k, ROZ_PIXEL(cx, cy), pal, tmask, tval, priority);
+	}
+
+#undef ROZ_PIXEL
+}
+
+// un-zoomed, un-rotated and wrapped: a scrolled copy of the page
+template <typename T, INT32 nTransp>
+static void roz_scroll(T *bitmap, UINT32 startx, UINT32 starty, INT32 height, const roz_source *s)
+{
+	const UINT32 *pal = s->pal;
+	const INT32 width = s->width;
+	const INT32 tmask = s->tmask;
+	const INT32 tval = s->tval;
+	const UINT8 priority = s->priority;
+
+	INT32 scrollx = (startx >> 16) % width;
+	INT32 scrolly = starty >> 16;
+
+	for (INT32 sy = 0; sy < nScreenHeight; sy++) {
+		UINT8 *pri = (sizeof(T) == 4 ? konami_priority_bitmap : pPrioDraw) + (sy * nScreenWidth);
+		UINT16 *src = s->src + (((scrolly + sy) % height) * width);
+		T *dst = bitmap + (sy * nScreenWidth);
+
+		for (INT32 sx = 0, xx = scrollx; sx < nScreenWidth; sx++) {
+			roz_plot<T, nTransp>(dst + sx, pri + sx, src[xx], pal, tmask, tval, priority);
+			if (++xx == width) xx = 0;
 		}
 	}
 }
 
-static inline void copy_roz16(INT32 chip, INT32 minx, INT32 maxx, INT32 miny, INT32 maxy, UINT32 startx, UINT32 starty, INT32 incxx, INT32 incxy, INT32 incyx, INT32 incyy, INT32 transp, INT32 transp_mask, INT32 priority)
+template <typename T>
+static void copy_roz(T *bitmap, UINT8 *pri, INT32 wrap, INT32 minx, INT32 maxx, INT32 miny, INT32 maxy, UINT32 startx, UINT32 starty, INT32 incxx, INT32 incxy, INT32 incyx, INT32 incyy, const roz_source *s)
 {
-	INT32 clip_minx, clip_maxx, clip_miny, clip_maxy;
+	T *dst = bitmap + maxx * miny; // right?
+	INT32 n = maxx - minx;
 
-	BurnBitmapGetClipDims(1, &clip_minx, &clip_maxx, &clip_miny, &clip_maxy);
+	if (n <= 0) return;
 
-	if (incxx == (1 << 16) && incxy == 0 && incyx == 0 && incyy == (1 << 16) && K053936Wrap[chip])
+	void (*span)(T*, UINT8*, INT32, UINT32, UINT32, INT32, INT32, const roz_source*);
+
+	if (s->tmask) {
+		span = wrap ? roz_span<T, 1, 1> : roz_span<T, 1, 0>;
+	} else {
+		span = wrap ? roz_span<T, 0, 1> : roz_span<T, 0, 0>;
+	}
+
+	for (INT32 sy = miny; sy < maxy; sy++, startx+=incyx, starty+=incyy)
 	{
-		INT32 scrollx = startx >> 16;
-		INT32 scrolly = starty >> 16;
+		span(dst, pri, n, startx, starty, incxx, incxy, s);
 
-		for (INT32 sy = 0; sy < nScreenHeight; sy++) {
-			UINT8  *pri = pPrioDraw + (sy * nScreenWidth);
-			UINT16 *src = BurnBitmapGetBitmap(1) + (((scrolly + sy) % clip_maxy) * clip_maxx);
-			UINT16 *dst = pTransDraw + (sy * nScreenWidth);
+		dst += n;
+		pri += n;
+	}
+}
 
-			for (INT32 sx = 0; sx < nScreenWidth; sx++) {
-				INT32 pxl = src[(scrollx+sx)%clip_maxx];
-				if ((pxl & transp_mask) == transp) continue;
+static inline void copy_roz32(INT32 chip, INT32 minx, INT32 maxx, INT32 miny, INT32 maxy, UINT32 startx, UINT32 starty, INT32 incxx, INT32 incxy, INT32 incyx, INT32 incyy, INT32 transp, INT32 priority)
+{
+	roz_source s;
+	s.src = tscreen[chip];
+	s.pal = konami_palette32;
+	s.width = nWidth[chip];
+	s.wmask = nWidth[chip] - 1;
+	s.hmask = nHeight[chip] - 1;
+	s.tmask = transp ? 0x8000 : 0;	// only tested for zero, 32-bit output skips pens with bit 15 set
+	s.tval = 0x8000;
+	s.priority = priority;
 
-				dst[sx] = pxl;
-				pri[sx] = priority;
-			}
+	if (incxx == (1 << 16) && incxy == 0 && incyx == 0 && incyy == (1 << 16) && K053936Wrap[chip])
+	{
+		if (s.tmask) {
+			roz_scroll<UINT32, 1>(konami_bitmap32, startx, starty, nHeight[chip], &s);
+		} else {
+			roz_scroll<UINT32, 0>(konami_bitmap32, startx, starty, nHeight[chip], &s);
 		}
 		return;
 	}
 
-	UINT8  *pri = pPrioDraw;
-	UINT16 *dst = pTransDraw;
-	UINT16 *src = BurnBitmapGetBitmap(1);
+	copy_roz<UINT32>(konami_bitmap32, konami_priority_bitmap, K053936Wrap[chip], minx, maxx, miny, maxy, startx, starty, incxx, incxy, incyx, incyy, &s);
+}
 
-	INT32 width = clip_maxx;
-	INT32 hmask = clip_maxy - 1;
-	INT32 wmask = clip_maxx - 1;
+static inline void copy_roz16(INT32 chip, INT32 minx, INT32 maxx, INT32 miny, INT32 maxy, UINT32 startx, UINT32 starty, INT32 incxx, INT32 incxy, INT32 incyx, INT32 incyy, INT32 transp, INT32 transp_mask, INT32 priority)
+{
+	INT32 clip_minx, clip_maxx, clip_miny, clip_maxy;
 
-	INT32 wrap = K053936Wrap[chip];
-	
-	dst += maxx * miny; // right?
+	BurnBitmapGetClipDims(1, &clip_minx, &clip_maxx, &clip_miny, &clip_maxy);
 
-	for (INT32 sy = miny; sy < maxy; sy++, startx+=incyx, starty+=incyy)
+	roz_source s;
+	s.src = BurnBitmapGetBitmap(1);
+	s.pal = NULL;
+	s.width = clip_maxx;
+	s.wmask = clip_maxx - 1;
+	s.hmask = clip_maxy - 1;
+	s.tmask = transp_mask;
+	s.tval = transp;
+	s.priority = priority;
+
+	if (incxx == (1 << 16) && incxy == 0 && incyx == 0 && incyy == (1 << 16) && K053936Wrap[chip])
 	{
-		UINT32 cx = startx;
-		UINT32 cy = starty;
-
-		if (transp_mask) {
-			if (wrap) {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++)
-				{
-					INT32 pxl = src[(((cy >> 16) & hmask) * width) + ((cx >> 16) & wmask)];
-		
-					if ((pxl & transp_mask) != transp) {
-						*dst = pxl;
-						*pri = priority;
-					}
-				}
-			} else {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++)
-				{
-					INT32 yy = cy >> 16;
-					if (yy > hmask || yy < 0) continue;
-					INT32 xx = cx >> 16;
-					if (xx > wmask || xx < 0) continue;
-
-					INT32 pxl = src[(yy * width) + xx];
-
-					if ((pxl & transp_mask) != transp) {
-						*dst = pxl;
-						*pri = priority;
-					}
-				}
-			}
-		} else {
-			if (wrap) {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++) {
-					*dst = src[(((cy >> 16) & hmask) * width) + ((cx >> 16) & wmask)] & 0x7fff;
-					*pri = priority;
-				}
-			} else {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++) {
-					INT32 yy = cy >> 16;
-					if (yy > hmask || yy < 0) continue;
-					INT32 xx = cx >> 16;
-					if (xx > wmask || xx < 0) continue;
-
-					*dst = src[(yy * width) + xx] & 0x7fff;
-					*pri = priority;
-				}
-			}
-		}
+		roz_scroll<UINT16, 1>(pTransDraw, startx, starty, clip_maxy, &s); // always masked, as before
+		return;
 	}
+
+	copy_roz<UINT16>(pTransDraw, pPrioDraw, K053936Wrap[chip], minx, maxx, miny, maxy, startx, starty, incxx, incxy, incyx, incyy, &s);
 }
 
 void K053936Draw(INT32 chip, UINT16 *ctrl, UINT16 *linectrl, INT32 flags)
@@ -603,154 +647,190 @@ void K053936GP_set_cliprect(INT32 chip, INT32 minx, INT32 maxx, INT32 miny, INT3
 	K053936_cliprect[chip][3] = maxy;	
 }
 
+// one line of n pixels from the 0x2000 x 0x2000 page, which always wraps so every
+// source offset is in range
+template <INT32 nBlend, INT32 nClip>
+static void K053936GP_span(UINT32 *dst, INT32 n, UINT32 cx, UINT32 cy, INT32 incxx, INT32 incxy, const UINT16 *src_base, const INT32 *src_clip, INT32 color_base, INT32 cmask, INT32 alpha)
+{
+	const UINT32 *pal_base = konami_palette32;
+	INT32 i = 0;
+
+	if (nClip == 0)
+	{
+		// four at a time, the source offsets are worked out together and all the
+		// reads go out before the stores
+#if defined K053936_SSE2
+		__m128i vx = _mm_add_epi32(_mm_set1_epi32(cx), _mm_setr_epi32(0, incxx, incxx * 2, incxx * 3));
+		__m128i vy = _mm_add_epi32(_mm_set1_epi32(cy), _mm_setr_epi32(0, incxy, incxy * 2, incxy * 3));
+		__m128i stepx = _mm_set1_epi32(incxx * 4);
+		__m128i stepy = _mm_set1_epi32(incxy * 4);
+		__m128i mask = _mm_set1_epi32(0x1fff);
+#elif defined K053936_NEON
+		const UINT32 lanex[4] = { 0, (UINT32)incxx, (UINT32)incxx * 2, (UINT32)incxx * 3 };
+		const UINT32 laney[4] = { 0, (UINT32)incxy, (UINT32)incxy * 2, (UINT32)incxy * 3 };
+		uint32x4_t vx = vaddq_u32(vdupq_n_u32(cx), vld1q_u32(lanex));
+		uint32x4_t vy = vaddq_u32(vdupq_n_u32(cy), vld1q_u32(laney));
+		uint32x4_t stepx = vdupq_n_u32((UINT32)incxx * 4);
+		uint32x4_t stepy = vdupq_n_u32((UINT32)incxy * 4);
+		uint32x4_t mask = vdupq_n_u32(0x1fff);
+#endif
+
+		for (; i + 4 <= n; i += 4)
+		{
+#if defined K053936_SSE2
+			__m128i offs = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(vy, 16), mask), 13), _mm_and_si128(_mm_srli_epi32(vx, 16), mask));
+
+			vx = _mm_add_epi32(vx, stepx);
+			vy = _mm_add_epi32(vy, stepy);
+
+			INT32 p0 = src_base[_mm_cvtsi128_si32(offs)] | color_base;
+			INT32 p1 = src_base[_mm_cvtsi128_si32(_mm_srli_si128(offs, 4))] | color_base;
+			INT32 p2 = src_base[_mm_cvtsi128_si32(_mm_srli_si128(offs, 8))] | color_base;
+			INT32 p3 = src_base[_mm_cvtsi128_si32(_mm_srli_si128(offs, 12))] | color_base;
+#elif defined K053936_NEON
+			uint32x4_t offs = vorrq_u32(vshlq_n_u32(vandq_u32(vshrq_n_u32(vy, 16), mask), 13), vandq_u32(vshrq_n_u32(vx, 16), mask));
+
+			vx = vaddq_u32(vx, stepx);
+			vy = vaddq_u32(vy, stepy);
+
+			INT32 p0 = src_base[vgetq_lane_u32(offs, 0)] | color_base;
+			INT32 p1 = src_base[vgetq_lane_u32(offs, 1)] | color_base;
+			INT32 p2 = src_base[vgetq_lane_u32(offs, 2)] | color_base;
+			INT32 p3 = src_base[vgetq_lane_u32(offs, 3)] | color_base;
+#else
+			INT32 p0 = src_base[(((cy >> 16) & 0x1fff) << 13) | ((cx >> 16) & 0x1fff)] | color_base;
+			cx += incxx; cy += incxy;
+			INT32 p1 = src_base[(((cy >> 16) & 0x1fff) << 13) | ((cx >> 16) & 0x1fff)] | color_base;
+			cx += incxx; cy += incxy;
+			INT32 p2 = src_base[(((cy >> 16) & 0x1fff) << 13) | ((cx >> 16) & 0x1fff)] | color_base;
+			cx += incxx; cy += incxy;
+			INT32 p3 = src_base[(((cy >> 16) & 0x1fff) << 13) | ((cx >> 16) & 0x1fff)] | color_base;
+			cx += incxx; cy += incxy;
+#endif
+
+			if (p0 & cmask) dst[i + 0] = nBlend ? alpha_blend(pal_base[p0], dst[i + 0], alpha) : pal_base[p0];
+			if (p1 & cmask) dst[i + 1] = nBlend ? alpha_blend(pal_base[p1], dst[i + 1], alpha) : pal_base[p1];
+			if (p2 & cmask) dst[i + 2] = nBlend ? alpha_blend(pal_base[p2], dst[i + 2], alpha) : pal_base[p2];
+			if (p3 & cmask) dst[i + 3] = nBlend ? alpha_blend(pal_base[p3], dst[i + 3], alpha) : pal_base[p3];
+		}
+
+#if defined K053936_SSE2 || defined K053936_NEON
+		cx += (UINT32)i * incxx;
+		cy += (UINT32)i * incxy;
+#endif
+	}
+
+	for (; i < n; i++, cx += incxx, cy += incxy)
+	{
+		INT32 srcx = (cx >> 16) & 0x1fff;
+		INT32 srcy = (cy >> 16) & 0x1fff;
+
+		if (nClip && (srcx < src_clip[0] || srcx > src_clip[1] || srcy < src_clip[2] || srcy > src_clip[3]))
+			continue;
+
+		INT32 pixel = src_base[(srcy << 13) | srcx] | color_base;
+		if (!(pixel & cmask))
+			continue;
+
+		dst[i] = nBlend ? alpha_blend(pal_base[pixel], dst[i], alpha) : pal_base[pixel];
+	}
+}
+
 static inline void K053936GP_copyroz32clip(INT32 chip, UINT16 *src_bitmap, INT32 *my_clip, UINT32 _startx,UINT32 _starty,INT32 _incxx,INT32 _incxy,INT32 _incyx,INT32 _incyy,
 		INT32 tilebpp, INT32 blend, INT32 alpha, INT32 clip, INT32 pixeldouble_output)
 {
 	static const INT32 colormask[8]={1,3,7,0xf,0x1f,0x3f,0x7f,0xff};
-	INT32 cy, cx;
-	INT32 ecx;
-	INT32 src_pitch, incxy, incxx;
-	INT32 src_minx, src_maxx, src_miny, src_maxy, cmask;
-	UINT16 *src_base;
-	INT32 src_size;
-
-	const UINT32 *pal_base;
-	INT32 dst_ptr;
-	INT32 dst_size;
-	INT32 dst_base2;
+	INT32 src_clip[4];
 
-	INT32 tx, dst_pitch;
-	UINT32 *dst_base;
-	INT32 starty, incyy, startx, incyx, ty, sx, sy;
-
-	incxy = _incxy; incxx = _incxx; incyy = _incyy; incyx = _incyx;
-	starty = _starty; startx = _startx;
+	UINT32 startx = _startx, starty = _starty;
+	INT32 incxx = _incxx, incxy = _incxy, incyx = _incyx, incyy = _incyy;
 
 	INT32 color_base = K053936_color[chip];
 
 	if (clip) // set source clip range to some extreme values when disabled
 	{
-		src_minx = K053936_cliprect[chip][0];
-		src_maxx = K053936_cliprect[chip][1];
-		src_miny = K053936_cliprect[chip][2];
-		src_maxy = K053936_cliprect[chip][3];
+		src_clip[0] = K053936_cliprect[chip][0];
+		src_clip[1] = K053936_cliprect[chip][1];
+		src_clip[2] = K053936_cliprect[chip][2];
+		src_clip[3] = K053936_cliprect[chip][3];
 	}
 	// this simply isn't safe to do!
-	else { src_minx = src_miny = -0x10000; src_maxx = src_maxy = 0x10000; }
+	else { src_clip[0] = src_clip[2] = -0x10000; src_clip[1] = src_clip[3] = 0x10000; }
 
 	// set target clip range
-	sx = my_clip[0];
-	tx = my_clip[1] - sx + 1;
-	sy = my_clip[2];
-	ty = my_clip[3] - sy + 1;
+	INT32 sx = my_clip[0];
+	INT32 tx = my_clip[1] - sx + 1;
+	INT32 sy = my_clip[2];
+	INT32 ty = my_clip[3] - sy + 1;
 
 	startx += sx * incxx + sy * incyx;
 	starty += sx * incxy + sy * incyy;
 
-	// adjust entry points and other loop constants
-	dst_pitch = nScreenWidth;
-	dst_base = konami_bitmap32;
-	dst_base2 = sy * dst_pitch + sx + tx;
-	ecx = tx = -tx;
-
-	tilebpp = (tilebpp-1) & 7;
-	pal_base = konami_palette32;
-	cmask = colormask[tilebpp];
-
-	src_pitch = 0x2000;
-	src_base = src_bitmap;
-	src_size = 0x2000 * 0x2000;
-	dst_size = nScreenWidth * nScreenHeight;
-	dst_ptr = 0;//dst_base;
-	cy = starty;
-	cx = startx;
-
-	if (blend > 0)
+	INT32 cmask = colormask[(tilebpp-1) & 7];
+
+	INT32 dst_pitch = nScreenWidth;
+	INT32 dst_size = nScreenWidth * nScreenHeight;
+	UINT32 *dst_base = konami_bitmap32;
+
+	if (pixeldouble_output)
 	{
-		dst_ptr += dst_pitch;      // draw blended
-		starty += incyy;
-		startx += incyx;
+		// a transparent pixel only advances the output by one, so the lines can't be
+		// treated as spans here
+		INT32 dst_base2 = sy * dst_pitch + sx + tx;
+		INT32 dst_ptr = dst_pitch;
+
+		for (INT32 y = 0; y < ty; y++, dst_ptr += dst_pitch, startx += incyx, starty += incyy)
+		{
+			UINT32 cx = startx;
+			UINT32 cy = starty;
 
-		do {
-			do {
+			for (INT32 ecx = -tx; ecx < 0; ecx++)
+			{
 				INT32 srcx = (cx >> 16) & 0x1fff;
 				INT32 srcy = (cy >> 16) & 0x1fff;
-				INT32 pixel;
-				INT32 offs;
-				offs = srcy * src_pitch + srcx;
 
 				cx += incxx;
 				cy += incxy;
 
-				if (offs>=src_size||offs<0)
+				if (srcx < src_clip[0] || srcx > src_clip[1] || srcy < src_clip[2] || srcy > src_clip[3])
 					continue;
 
-				if (srcx < src_minx || srcx > src_maxx || srcy < src_miny || srcy > src_maxy)
-					continue;
-
-				pixel = src_base[offs]|color_base;
+				INT32 pixel = src_bitmap[(srcy << 13) | srcx] | color_base;
 				if (!(pixel & cmask))
 					continue;
-// this one below is borked.
-				if ((dst_ptr+ecx+dst_base2)<dst_size) dst_base[dst_ptr+ecx+dst_base2] = alpha_blend(pal_base[pixel], dst_base[dst_ptr+ecx+dst_base2], alpha);
 
-				if (pixeldouble_output)
-				{
-					ecx++;
-					if ((dst_ptr+ecx+dst_base2)<dst_size) dst_base[dst_ptr+ecx+dst_base2] = alpha_blend(pal_base[pixel], dst_base[dst_ptr+ecx+dst_base2], alpha);
-				}
-			}
-			while (++ecx < 0);
+				UINT32 color = konami_palette32[pixel];
+				INT32 offs = dst_ptr + ecx + dst_base2;
 
-			ecx = tx;
-			dst_ptr += dst_pitch;
-			cy = starty; starty += incyy;
-			cx = startx; startx += incyx;
-		} while (--ty);
-	}
-	else    //  draw solid
-	{
-		dst_ptr += dst_pitch;
-		starty += incyy;
-		startx += incyx;
+				if (offs < dst_size) dst_base[offs] = (blend > 0) ? alpha_blend(color, dst_base[offs], alpha) : color;
 
-		do {
-			do {
-				INT32 srcx = (cx >> 16) & 0x1fff;
-				INT32 srcy = (cy >> 16) & 0x1fff;
-				INT32 pixel;
-				INT32 offs;
+				ecx++;
+				offs++;
 
-				offs = srcy * src_pitch + srcx;
-
-				cx += incxx;
-				cy += incxy;
+				if (offs < dst_size) dst_base[offs] = (blend > 0) ? alpha_blend(color, dst_base[offs], alpha) : color;
+			}
+		}
+		return;
+	}
 
-				if (offs>=src_size||offs<0)
-					continue;
+	void (*span)(UINT32*, INT32, UINT32, UINT32, INT32, INT32, const UINT16*, const INT32*, INT32, INT32, INT32);
 
-				if (srcx < src_minx || srcx > src_maxx || srcy < src_miny || srcy > src_maxy)
-					continue;
+	if (blend > 0) {
+		span = clip ? K053936GP_span<1, 1> : K053936GP_span<1, 0>;
+	} else {
+		span = clip ? K053936GP_span<0, 1> : K053936GP_span<0, 0>;
+	}
 
-				pixel = src_base[offs]|color_base;
-				if (!(pixel & cmask))
-					continue;
+	// this is drawn one line down from the target clip, which the end of the bitmap cuts off
+	INT32 dst_offs = (sy + 1) * dst_pitch + sx;
 
-				if ((dst_ptr+ecx+dst_base2)<dst_size) dst_base[dst_ptr+ecx+dst_base2] = pal_base[pixel];
+	for (INT32 y = 0; y < ty; y++, dst_offs += dst_pitch, startx += incyx, starty += incyy)
+	{
+		if (dst_offs >= dst_size) break;
 
-				if (pixeldouble_output)
-				{
-					ecx++;
-					if ((dst_ptr+ecx+dst_base2)<dst_size) dst_base[dst_ptr+ecx+dst_base2] = pal_base[pixel];
-				}
-			}
-			while (++ecx < 0);
+		INT32 n = (tx < dst_size - dst_offs) ? tx : (dst_size - dst_offs);
 
-			ecx = tx;
-			dst_ptr += dst_pitch;
-			cy = starty; starty += incyy;
-			cx = startx; startx += incyx;
-		} while (--ty);
+		span(dst_base + dst_offs, n, startx, starty, incxx, incxy, src_bitmap, src_clip, color_base, cmask, alpha);
 	}
 }
 
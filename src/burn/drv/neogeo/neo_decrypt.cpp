@@ -61,6 +61,7 @@ analyzed, quickly leading to the algorithm.
 
 #include "neogeo.h"
 #include "bitswap.h"
+#include "burn_profile.h"
 
 
 const UINT8 *type0_t03;
@@ -508,6 +509,8 @@ void NeoCMCDecrypt(INT32 extra_xor, UINT8* rom, UINT8* buf, INT32 offset, INT32
 {
 	INT32 clamp_size, rpos;
 
+	BurnProfileBegin("decrypt");
+
 	if (rom_size > 0x04000000) rom_size = 0x04000000;
 
 	// Adjust variables for addressing 32bit words
@@ -546,6 +549,8 @@ void NeoCMCDecrypt(INT32 extra_xor, UINT8* rom, UINT8* buf, INT32 offset, INT32
 
 		((UINT32*)rom)[baser] = ((UINT32*)buf)[rpos];
 	}
+
+	BurnProfileEnd();
 }
 
 /* CMC42 protection chip */
@@ -74,6 +74,7 @@
 #include "burn_ym2610.h"
 #include "bitswap.h"
 #include "neocdlist.h"
+#include "burn_cache.h"
 
 // #undef USE_SPEEDHACKS
 #define IRQ_TWEAK 3 // test-fix for Spin Master
@@ -101,6 +102,9 @@
 // If defined, use kludges to better align raster effects in some games (e.g. mosyougi)
 #define RASTER_KLUDGE
 
+// Version of the cached decoded sprite/text data (burn_cache.h), bump when their decode changes
+#define NEO_CACHE_VERSION 1
+
 // If defined, use the bAllowRasters variable to enable/disable raster effects
 // #define RASTERS_OPTIONAL
 
@@ -717,8 +721,14 @@ static INT32 LoadRoms()
 		BurnSetProgressRange(1.0 / pInfo->nSpriteNum);
 	}
 
+	// With the decoded sprites and text in the cache the C and S ROMs aren't loaded at all.
+	// The init callback below still runs over the empty areas, its result is overwritten
+	bool bCached = BurnCacheCheck("sprites", NEO_CACHE_VERSION, nSpriteSize[nNeoActiveSlot]) && BurnCacheCheck("text", NEO_CACHE_VERSION, nNeoTextROMSize[nNeoActiveSlot]);
+
 	// Load sprite data
-	NeoLoadSprites(pInfo->nSpriteOffset, pInfo->nSpriteNum, NeoSpriteROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot]);
+	if (!bCached) {
+		NeoLoadSprites(pInfo->nSpriteOffset, pInfo->nSpriteNum, NeoSpriteROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot]);
+	}
 
 	NeoTextROM[nNeoActiveSlot] = (UINT8*)BurnMalloc(nNeoTextROMSize[nNeoActiveSlot]);
 	if (NeoTextROM[nNeoActiveSlot] == NULL) {
@@ -726,7 +736,7 @@ static INT32 LoadRoms()
 	}
 
 	// Load Text layer tiledata
-	{
+	if (!bCached) {
 		if (pInfo->nTextOffset != -1) {
 			// Load S ROM data
 			BurnLoadRom(NeoTextROM[nNeoActiveSlot], pInfo->nTextOffset, 1);
@@ -773,12 +783,22 @@ static INT32 LoadRoms()
 		NeoCallbackActive->pInitialise();
 	}
 
-	// Decode text data
-	BurnUpdateProgress(0.0, _T("Preprocessing text layer graphics...")/*, BST_PROCESS_TXT*/, 0);
-	NeoDecodeText(0, nNeoTextROMSize[nNeoActiveSlot], NeoTextROM[nNeoActiveSlot], NeoTextROM[nNeoActiveSlot]);
+	if (bCached) {
+		if (BurnCacheLoad("sprites", NEO_CACHE_VERSION, NeoSpriteROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot]) ||
+			BurnCacheLoad("text", NEO_CACHE_VERSION, NeoTextROM[nNeoActiveSlot], nNeoTextROMSize[nNeoActiveSlot])) {
+			return 1;
+		}
+	} else {
+		// Decode text data
+		BurnUpdateProgress(0.0, _T("Preprocessing text layer graphics...")/*, BST_PROCESS_TXT*/, 0);
+		NeoDecodeText(0, nNeoTextROMSize[nNeoActiveSlot], NeoTextROM[nNeoActiveSlot], NeoTextROM[nNeoActiveSlot]);
 
-	// Decode sprite data
-	NeoDecodeSprites(NeoSpriteROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot]);
+		// Decode sprite data
+		NeoDecodeSprites(NeoSpriteROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot]);
+
+		BurnCacheSave("sprites", NEO_CACHE_VERSION, NeoSpriteROM[nNeoActiveSlot], nSpriteSize[nNeoActiveSlot]);
+		BurnCacheSave("text", NEO_CACHE_VERSION, NeoTextROM[nNeoActiveSlot], nNeoTextROMSize[nNeoActiveSlot]);
+	}
 
 	if (pInfo->nADPCMANum) {
 		char* pName;
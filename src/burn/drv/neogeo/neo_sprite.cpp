@@ -34,6 +34,28 @@ static RenderBankFunction* RenderBank;
 
 static 	UINT16 BankAttrib01, BankAttrib02, BankAttrib03;
 
+// Sprite strips that can show up on screen, found by walking the sprite chain.
+// The walk only depends on SCB2-4 (and on where the previous walk left off), so
+// when a frame is drawn in several slices it is done once and reused until the
+// sprite RAM changes.  Each slice then only visits the strips crossing its lines.
+struct NeoSpriteStrip {
+	UINT16 nBank;
+	INT16  nXPos;
+	INT16  nYPos;
+	UINT8  nYZoom;
+	UINT8  nSize;
+	UINT8  nFunction;		// RenderBank[] index
+};
+
+#define SPRITE_LIST_STATE	5	// nBankXPos, nBankYPos, nBankXZoom, nBankYZoom, nBankSize
+
+static NeoSpriteStrip NeoSpriteList[0x17D];
+static INT32 nNeoSpriteListCount;
+static UINT8 NeoSpriteListAttrib[0x0C00];				// SCB2-4 the list was built from
+static INT32 NeoSpriteListKey[SPRITE_LIST_STATE + 2];	// walk start state, nStart, screen width
+static INT32 NeoSpriteListEnd[SPRITE_LIST_STATE];		// state the walk finished with
+static bool bNeoSpriteListValid = false;
+
 static inline UINT32 alpha_blend(UINT32 d, UINT32 s, UINT32 p)
 {
 	INT32 a = 255 - p;
@@ -45,6 +67,66 @@ static inline UINT32 alpha_blend(UINT32 d, UINT32 s, UINT32 p)
 // Include the tile rendering functions
 #include "neo_sprite_func.h"
 
+static void NeoBuildSpriteList(INT32 nStart)
+{
+	nNeoSpriteListCount = 0;
+
+	for (INT32 nBank = 0; nBank < 0x17D; nBank++) {
+		INT32 zBank = (nBank + nStart) % 0x17d;
+		BankAttrib01 = *((UINT16*)(NeoGraphicsRAM + 0x010000 + (zBank << 1)));
+		BankAttrib02 = *((UINT16*)(NeoGraphicsRAM + 0x010400 + (zBank << 1)));
+		BankAttrib03 = *((UINT16*)(NeoGraphicsRAM + 0x010800 + (zBank << 1)));
+
+		if (BankAttrib02 & 0x40) {
+			nBankXPos += nBankXZoom + 1;
+		} else {
+			nBankYPos = (0x0200 - (BankAttrib02 >> 7)) & 0x01FF;
+			nBankXPos = (BankAttrib03 >> 7);
+			if (nNeoScreenWidth == 304) {
+				nBankXPos -= 8;
+			}
+
+			nBankYZoom = BankAttrib01 & 0xFF;
+			nBankSize  = BankAttrib02 & 0x3F;
+
+//			if (nBankSize > 0x10 && nSliceStart == 0x10) bprintf(PRINT_NORMAL, _T("bank: %04X, x: %04X, y: %04X, zoom: %02X, size: %02X.\n"), zBank, nBankXPos, nBankYPos, nBankYZoom, nBankSize);
+		}
+
+		if (nBankSize) {
+			nBankXZoom = (BankAttrib01 >> 8) & 0x0F;
+			if (nBankXPos >= 0x01E0) {
+				nBankXPos -= 0x200;
+			}
+
+			INT32 nFunction = -1;
+			if (nBankXPos >= 0 && nBankXPos < (nNeoScreenWidth - nBankXZoom - 1)) {
+				nFunction = nBankXZoom;
+			} else {
+				if (nBankXPos >= -nBankXZoom && nBankXPos < nNeoScreenWidth) {
+					nFunction = nBankXZoom + 16;
+				}
+			}
+
+			if (nFunction >= 0) {
+				NeoSpriteStrip *pStrip = &NeoSpriteList[nNeoSpriteListCount++];
+
+				pStrip->nBank     = zBank;
+				pStrip->nXPos     = nBankXPos;
+				pStrip->nYPos     = nBankYPos;
+				pStrip->nYZoom    = nBankYZoom;
+				pStrip->nSize     = nBankSize;
+				pStrip->nFunction = nFunction;
+			}
+		}
+	}
+
+	NeoSpriteListEnd[0] = nBankXPos;
+	NeoSpriteListEnd[1] = nBankYPos;
+	NeoSpriteListEnd[2] = nBankXZoom;
+	NeoSpriteListEnd[3] = nBankYZoom;
+	NeoSpriteListEnd[4] = nBankSize;
+}
+
 INT32 NeoRenderSprites()
 {
 	if (nLastBPP != nBurnBpp ) {
@@ -76,45 +158,42 @@ INT32 NeoRenderSprites()
 		}
 	}
 
-	for (INT32 nBank = 0; nBank < 0x17D; nBank++) {
-		INT32 zBank = (nBank + nStart) % 0x17d;
-		BankAttrib01 = *((UINT16*)(NeoGraphicsRAM + 0x010000 + (zBank << 1)));
-		BankAttrib02 = *((UINT16*)(NeoGraphicsRAM + 0x010400 + (zBank << 1)));
-		BankAttrib03 = *((UINT16*)(NeoGraphicsRAM + 0x010800 + (zBank << 1)));
+	INT32 nKey[SPRITE_LIST_STATE + 2] = { nBankXPos, nBankYPos, nBankXZoom, nBankYZoom, nBankSize, nStart, nNeoScreenWidth };
 
-		pBank = (UINT16*)(NeoGraphicsRAM + (zBank << 7));
+	if (!bNeoSpriteListValid || memcmp(NeoSpriteListKey, nKey, sizeof(nKey)) || memcmp(NeoSpriteListAttrib, NeoGraphicsRAM + 0x010000, sizeof(NeoSpriteListAttrib))) {
+		NeoBuildSpriteList(nStart);
 
-		if (BankAttrib02 & 0x40) {
-			nBankXPos += nBankXZoom + 1;
-		} else {
-			nBankYPos = (0x0200 - (BankAttrib02 >> 7)) & 0x01FF;
-			nBankXPos = (BankAttrib03 >> 7);
-			if (nNeoScreenWidth == 304) {
-				nBankXPos -= 8;
-			}
+		memcpy(NeoSpriteListKey, nKey, sizeof(nKey));
+		memcpy(NeoSpriteListAttrib, NeoGraphicsRAM + 0x010000, sizeof(NeoSpriteListAttrib));
+		bNeoSpriteListValid = true;
+	}
 
-			nBankYZoom = BankAttrib01 & 0xFF;
-			nBankSize  = BankAttrib02 & 0x3F;
+	for (INT32 i = 0; i < nNeoSpriteListCount; i++) {
+		NeoSpriteStrip *pStrip = &NeoSpriteList[i];
 
-//			if (nBankSize > 0x10 && nSliceStart == 0x10) bprintf(PRINT_NORMAL, _T("bank: %04X, x: %04X, y: %04X, zoom: %02X, size: %02X.\n"), zBank, nBankXPos, nBankYPos, nBankYZoom, nBankSize);
+		// A strip covers lines nYPos .. nYPos + nLinesTotal (wrapping at 512), skip it if none are in this slice
+		if (pStrip->nSize < 0x20) {
+			INT32 nLinesTotal = (pStrip->nSize << 4) - 1;
+			if (((nSliceStart - pStrip->nYPos) & 0x01FF) > nLinesTotal && (pStrip->nYPos < nSliceStart || pStrip->nYPos >= nSliceEnd)) {
+				continue;
+			}
 		}
 
-		if (nBankSize) {
-			nBankXZoom = (BankAttrib01 >> 8) & 0x0F;
-			if (nBankXPos >= 0x01E0) {
-				nBankXPos -= 0x200;
-			}
+		pBank      = (UINT16*)(NeoGraphicsRAM + (pStrip->nBank << 7));
+		nBankXPos  = pStrip->nXPos;
+		nBankYPos  = pStrip->nYPos;
+		nBankYZoom = pStrip->nYZoom;
+		nBankSize  = pStrip->nSize;
 
-			if (nBankXPos >= 0 && nBankXPos < (nNeoScreenWidth - nBankXZoom - 1)) {
-				RenderBank[nBankXZoom]();
-			} else {
-				if (nBankXPos >= -nBankXZoom && nBankXPos < nNeoScreenWidth) {
-					RenderBank[nBankXZoom + 16]();
-				}
-			}
-		}
+		RenderBank[pStrip->nFunction]();
 	}
 
+	nBankXPos  = NeoSpriteListEnd[0];
+	nBankYPos  = NeoSpriteListEnd[1];
+	nBankXZoom = NeoSpriteListEnd[2];
+	nBankYZoom = NeoSpriteListEnd[3];
+	nBankSize  = NeoSpriteListEnd[4];
+
 //	bprintf(PRINT_NORMAL, _T("\n"));
 
 	return 0;
@@ -229,6 +308,8 @@ INT32 NeoInitSprites(INT32 nSlot)
 
 	if (bBurnUseBlend) NeoBlendInit(nSlot);
 
+	bNeoSpriteListValid = false;
+
 	NeoTileAttribActive = NeoTileAttrib[nSlot];
 	NeoSpriteROMActive  = NeoSpriteROM[nSlot];
 	nNeoTileMaskActive  = nNeoTileMask[nSlot];
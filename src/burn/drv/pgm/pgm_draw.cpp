@@ -1,5 +1,11 @@
 #include "pgm.h"
 #include "pgm_sprite.h"
+#include "burn_thread.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PGM_SSE2
+#include <emmintrin.h>
+#endif
 
 //#define DUMP_SPRITE_BITMAPS
 //#define DRAW_SPRITE_NUMBER
@@ -10,10 +16,12 @@ static INT32   nTileMask = 0;
 static UINT8   sprmsktab[0x100];
 static UINT8  *SpritePrio;		// sprite priorities
 static UINT16 *pTempScreen;		// sprites
-static UINT16 *pTempDraw;		// pre-zoomed sprites
+static UINT8  *pTempDraw;		// pre-zoomed sprites (when not cached)
 static UINT8  *tiletrans;		// tile transparency table
 static UINT8  *texttrans;		// text transparency table
 static UINT32 *pTempDraw32;		// 32 bit temporary bitmap (blending!)
+static UINT16 *pBgDraw;			// background layer, BG_TRANSPARENT where nothing was drawn
+static UINT32 *pBgDraw32;		// same memory, used when blending
 static UINT8  *pSpriteBlendTable;	// if blending is available, allocate this.
 
 static inline UINT32 alpha_blend(UINT32 d, UINT32 s, UINT32 p)
@@ -138,14 +146,13 @@ inline static UINT32 CalcCol(UINT16 nColour)
 	return BurnHighCol(r, g, b, 0);
 }
 
-static void pgm_prepare_sprite(INT32 wide, INT32 high, INT32 palt, INT32 boffset)
+// decode a zoomed sprite to 8bpp pens, 0xff is transparent (the palette is added when drawing)
+static void pgm_prepare_sprite(UINT8 *dest, INT32 wide, INT32 high, INT32 boffset)
 {
-	UINT16* dest = pTempDraw;
 	UINT8 * bdata = PGMSPRMaskROM;
 	INT32 bdatasize = nPGMSPRMaskMaskLen;
 
 	wide *= 16;
-	palt *= 32;
 
 	UINT32 aoffset = (bdata[(boffset+3) & bdatasize] << 24) | (bdata[(boffset+2) & bdatasize] << 16) | (bdata[(boffset+1) & bdatasize] << 8) | (bdata[(boffset) & bdatasize]);
 	aoffset = (aoffset >> 2) * 3;
@@ -156,7 +163,7 @@ static void pgm_prepare_sprite(INT32 wide, INT32 high, INT32 palt, INT32 boffset
 	{
 		for (INT32 xcnt = 0; xcnt < wide; xcnt+=8)
 		{
-			aoffset+=zoom_draw_table[bdata[boffset & bdatasize]](dest + xcnt, PGMSPRColROM + (aoffset & nPGMSPRColMaskLen), palt);
+			aoffset+=zoom_draw_table[bdata[boffset & bdatasize]](dest + xcnt, PGMSPRColROM + (aoffset & nPGMSPRColMaskLen));
 
 			boffset++;
 		}
@@ -165,7 +172,161 @@ static void pgm_prepare_sprite(INT32 wide, INT32 high, INT32 palt, INT32 boffset
 	}
 }
 
-static inline void draw_sprite_line(INT32 wide, UINT16* dest, UINT8 *pdest, INT32 xzoom, INT32 xgrow, INT32 yoffset, INT32 flip, INT32 xpos, INT32 prio)
+// Decoded sprite cache
+//
+// Decoding a zoomed sprite walks its whole mask / colour stream, and games
+// redraw the same sprites every frame, so decoded pens are kept in a ring
+// arena keyed on (boffset, wide, high).  Entries are added at the head and
+// dropped from the tail; a hit on an entry in the oldest quarter of the ring
+// moves it back to the head, so what gets dropped is what hasn't been drawn
+// for the longest time.  The roms never change after init, so nothing else
+// ever invalidates an entry.
+
+#define SPRCACHE_HASH_BITS	12
+#define SPRCACHE_MAX_SIZE	0x2000000
+#define SPRCACHE_MIN_SIZE	0x0200000
+
+struct sprite_cache_entry {
+	UINT32 boffset;
+	UINT16 wide;		// 0 = dead, waiting for the tail to pass
+	UINT16 high;
+	INT32 next;		// hash chain, -1 terminates
+	INT32 size;		// including this header
+};
+
+static UINT8 *pSpriteCache = NULL;
+static INT32 nSpriteCacheSize;
+static INT32 nSpriteCacheHead;
+static INT32 nSpriteCacheTail;
+static INT32 nSpriteCacheWrap;		// end of the data above the head after it wrapped, -1 if none
+static INT32 nSpriteCacheEntries;
+static INT32 SpriteCacheHash[1 << SPRCACHE_HASH_BITS];
+
+static inline sprite_cache_entry *sprite_cache_entry_at(INT32 offset)
+{
+	return (sprite_cache_entry*)(pSpriteCache + offset);
+}
+
+static inline INT32 sprite_cache_hash(UINT32 boffset, UINT32 wide, UINT32 high)
+{
+	return ((boffset * 0x9e3779b1) ^ (((wide << 9) | high) * 0x85ebca6b)) >> (32 - SPRCACHE_HASH_BITS);
+}
+
+static void sprite_cache_reset()
+{
+	nSpriteCacheHead = 0;
+	nSpriteCacheTail = 0;
+	nSpriteCacheWrap = -1;
+	nSpriteCacheEntries = 0;
+
+	for (INT32 i = 0; i < (1 << SPRCACHE_HASH_BITS); i++) {
+		SpriteCacheHash[i] = -1;
+	}
+}
+
+static void sprite_cache_unlink(INT32 offset)
+{
+	sprite_cache_entry *entry = sprite_cache_entry_at(offset);
+	INT32 *link = &SpriteCacheHash[sprite_cache_hash(entry->boffset, entry->wide, entry->high)];
+
+	while (*link != offset) link = &sprite_cache_entry_at(*link)->next;
+
+	*link = entry->next;
+	entry->wide = 0;
+}
+
+static void sprite_cache_evict_tail()
+{
+	sprite_cache_entry *entry = sprite_cache_entry_at(nSpriteCacheTail);
+
+	if (entry->wide) sprite_cache_unlink(nSpriteCacheTail);
+
+	nSpriteCacheTail += entry->size;
+
+	if (nSpriteCacheTail == nSpriteCacheWrap) {
+		nSpriteCacheTail = 0;
+		nSpriteCacheWrap = -1;
+	}
+
+	if (--nSpriteCacheEntries == 0) {
+		nSpriteCacheTail = nSpriteCacheHead;
+		nSpriteCacheWrap = -1;
+	}
+}
+
+static INT32 sprite_cache_alloc(INT32 size)
+{
+	if (nSpriteCacheHead + size > nSpriteCacheSize)
+	{
+		// drop whatever is left above the head and start over at the bottom
+		while (nSpriteCacheEntries && nSpriteCacheTail >= nSpriteCacheHead) sprite_cache_evict_tail();
+
+		nSpriteCacheWrap = nSpriteCacheEntries ? nSpriteCacheHead : -1;
+		nSpriteCacheHead = 0;
+	}
+
+	while (nSpriteCacheEntries && nSpriteCacheTail >= nSpriteCacheHead && nSpriteCacheTail < nSpriteCacheHead + size) sprite_cache_evict_tail();
+
+	INT32 offset = nSpriteCacheHead;
+
+	if (nSpriteCacheEntries++ == 0) nSpriteCacheTail = offset;
+	nSpriteCacheHead += size;
+
+	return offset;
+}
+
+static void sprite_cache_link(INT32 offset, UINT32 boffset, INT32 wide, INT32 high, INT32 size)
+{
+	INT32 hash = sprite_cache_hash(boffset, wide, high);
+	sprite_cache_entry *entry = sprite_cache_entry_at(offset);
+
+	entry->boffset = boffset;
+	entry->wide = wide;
+	entry->high = high;
+	entry->size = size;
+	entry->next = SpriteCacheHash[hash];
+	SpriteCacheHash[hash] = offset;
+}
+
+// returns the decoded sprite, valid until the next call
+static UINT8 *pgm_get_sprite(INT32 wide, INT32 high, INT32 boffset)
+{
+	INT32 size = (sizeof(sprite_cache_entry) + (wide * 16 * high) + 15) & ~15;
+
+	if (pSpriteCache == NULL || size > nSpriteCacheSize / 4) {
+		pgm_prepare_sprite(pTempDraw, wide, high, boffset);
+		return pTempDraw;
+	}
+
+	for (INT32 offset = SpriteCacheHash[sprite_cache_hash(boffset, wide, high)]; offset >= 0; offset = sprite_cache_entry_at(offset)->next)
+	{
+		sprite_cache_entry *entry = sprite_cache_entry_at(offset);
+
+		if (entry->boffset != (UINT32)boffset || entry->wide != wide || entry->high != high) continue;
+
+		INT32 distance = (offset >= nSpriteCacheHead) ? (offset - nSpriteCacheHead) : (offset + nSpriteCacheSize - nSpriteCacheHead);
+
+		if (distance < nSpriteCacheSize / 4)
+		{
+			// about to be recycled, move it back to the head (the data survives the unlink)
+			sprite_cache_unlink(offset);
+			INT32 moved = sprite_cache_alloc(size);
+			memmove(pSpriteCache + moved + sizeof(sprite_cache_entry), pSpriteCache + offset + sizeof(sprite_cache_entry), size - sizeof(sprite_cache_entry));
+			sprite_cache_link(moved, boffset, wide, high, size);
+			offset = moved;
+		}
+
+		return pSpriteCache + offset + sizeof(sprite_cache_entry);
+	}
+
+	INT32 offset = sprite_cache_alloc(size);
+	sprite_cache_link(offset, boffset, wide, high, size);
+	pgm_prepare_sprite(pSpriteCache + offset + sizeof(sprite_cache_entry), wide, high, boffset);
+
+	return pSpriteCache + offset + sizeof(sprite_cache_entry);
+}
+
+static inline void draw_sprite_line(INT32 wide, UINT16* dest, UINT8 *pdest, INT32 xzoom, INT32 xgrow, const UINT8 *src, INT32 palt, INT32 flip, INT32 xpos, INT32 prio)
 {
 	INT32 xzoombit;
 	INT32 xoffset;
@@ -180,24 +341,24 @@ static inline void draw_sprite_line(INT32 wide, UINT16* dest, UINT8 *pdest, INT3
 		if (flip) xoffset = wide - xcnt - 1;
 		else	  xoffset = xcnt;
 
-		UINT32 srcdat = pTempDraw[yoffset + xoffset];
+		UINT32 srcdat = src[xoffset];
 		xzoombit = (xzoom >> (xcnt & 0x1f)) & 1;
 
 		if (xzoombit == 1 && xgrow == 1)
 		{
 			xdrawpos = xpos + xcntdraw;
 
-			if (!(srcdat & 0x8000))
+			if (srcdat != 0xff)
 			{
 				if ((xdrawpos >= 0) && (xdrawpos < nScreenWidth)) {
-					dest[xdrawpos] = srcdat;
+					dest[xdrawpos] = srcdat + palt;
 					pdest[xdrawpos] = prio;
 				}
 
 				xdrawpos = xpos + xcntdraw + 1;
 
 				if ((xdrawpos >= 0) && (xdrawpos < nScreenWidth)) {
-					dest[xdrawpos] = srcdat;
+					dest[xdrawpos] = srcdat + palt;
 					pdest[xdrawpos] = prio;
 				}
 			}
@@ -212,10 +373,10 @@ static inline void draw_sprite_line(INT32 wide, UINT16* dest, UINT8 *pdest, INT3
 		{
 			xdrawpos = xpos + xcntdraw;
 
-			if (!(srcdat & 0x8000))
+			if (srcdat != 0xff)
 			{
 				if ((xdrawpos >= 0) && (xdrawpos < nScreenWidth)) {
-					dest[xdrawpos] = srcdat;
+					dest[xdrawpos] = srcdat + palt;
 					pdest[xdrawpos] = prio;
 				}
 			}
@@ -541,7 +702,9 @@ static void draw_sprite_new_zoomed(INT32 wide, INT32 high, INT32 xpos, INT32 ypo
 	INT32 ycntdraw;
 	INT32 yzoombit;
 
-	pgm_prepare_sprite(wide, high, palt, boffset);
+	UINT8 *sprite = pgm_get_sprite(wide, high, boffset);
+
+	palt <<= 5;
 
 	ycnt = 0;
 	ycntdraw = 0;
@@ -559,7 +722,7 @@ static void draw_sprite_new_zoomed(INT32 wide, INT32 high, INT32 xpos, INT32 ypo
 			{
 				dest = pTempScreen + ydrawpos * nScreenWidth;
 				pdest = SpritePrio + ydrawpos * nScreenWidth;
-				draw_sprite_line(wide, dest, pdest, xzoom, xgrow, yoffset, flip, xpos, prio);
+				draw_sprite_line(wide, dest, pdest, xzoom, xgrow, sprite + yoffset, palt, flip, xpos, prio);
 			}
 			ycntdraw++;
 
@@ -570,7 +733,7 @@ static void draw_sprite_new_zoomed(INT32 wide, INT32 high, INT32 xpos, INT32 ypo
 			{
 				dest = pTempScreen + ydrawpos * nScreenWidth;
 				pdest = SpritePrio + ydrawpos * nScreenWidth;
-				draw_sprite_line(wide, dest, pdest, xzoom, xgrow, yoffset, flip, xpos, prio);
+				draw_sprite_line(wide, dest, pdest, xzoom, xgrow, sprite + yoffset, palt, flip, xpos, prio);
 			}
 			ycntdraw++;
 
@@ -591,7 +754,7 @@ static void draw_sprite_new_zoomed(INT32 wide, INT32 high, INT32 xpos, INT32 ypo
 			{
 				dest = pTempScreen + ydrawpos * nScreenWidth;
 				pdest = SpritePrio + ydrawpos * nScreenWidth;
-				draw_sprite_line(wide, dest, pdest, xzoom, xgrow, yoffset, flip, xpos, prio);
+				draw_sprite_line(wide, dest, pdest, xzoom, xgrow, sprite + yoffset, palt, flip, xpos, prio);
 			}
 			ycntdraw++;
 
@@ -644,32 +807,83 @@ static void pgm_drawsprites()
 	}
 }
 
-static void copy_sprite_priority(INT32 prio)
+#define BG_TRANSPARENT		0xffff
+#define BG_TRANSPARENT32	0xffffffff
+
+// one pass over the screen, back to front: backdrop, priority 1 sprites, background, priority 0 sprites
+static void pgm_composite()
 {
-	UINT16 *src = pTempScreen;
+	UINT16 *spr = pTempScreen;
 	UINT8 *pri = SpritePrio;
+	INT32 nPixels = nScreenWidth * nScreenHeight;
+
+	INT32 pri1 = (nSpriteEnable & 1) ? 1 : 0xfe;	// a disabled priority never matches
+	INT32 pri0 = (nSpriteEnable & 2) ? 0 : 0xfd;
+	INT32 bg_on = nBurnLayer & 1;
 
 	if (enable_blending) {
 		UINT32 *dest = pTempDraw32;
+		UINT32 backdrop = RamCurPal[0x900];
 		INT32 blend_levels[16] = { 0x00, 0x1f, 0x2f, 0x3f, 0x4f, 0x5f, 0x6f, 0x7f, 0x8f, 0x9f, 0xaf, 0xbf, 0xcf, 0xdf, 0xef, 0xff };
 
-		for (INT32 i = 0; i < nScreenWidth * nScreenHeight; i++)
+		for (INT32 i = 0; i < nPixels; i++)
 		{
-			if (pri[i] == prio) {
-				if (src[i]&0xf000) {
-					dest[i] = alpha_blend(dest[i], RamCurPal[src[i]&0xfff], blend_levels[src[i]/0x1000]);
-				} else {
-					dest[i] = RamCurPal[src[i]];
-				}
+			UINT32 pxl = backdrop;
+
+			if (pri[i] == pri1) {
+				pxl = (spr[i]&0xf000) ? alpha_blend(pxl, RamCurPal[spr[i]&0xfff], blend_levels[spr[i]/0x1000]) : RamCurPal[spr[i]];
 			}
+
+			if (bg_on && pBgDraw32[i] != BG_TRANSPARENT32) {
+				pxl = pBgDraw32[i];
+			}
+
+			if (pri[i] == pri0) {
+				pxl = (spr[i]&0xf000) ? alpha_blend(pxl, RamCurPal[spr[i]&0xfff], blend_levels[spr[i]/0x1000]) : RamCurPal[spr[i]];
+			}
+
+			dest[i] = pxl;
 		}
 	} else {
 		UINT16 *dest = pTransDraw;
-		for (INT32 i = 0; i < nScreenWidth * nScreenHeight; i++)
+		INT32 i = 0;
+
+#if defined PGM_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i backdrop = _mm_set1_epi16(0x900);
+		const __m128i bg_trans = _mm_set1_epi16((INT16)BG_TRANSPARENT);
+		const __m128i bg_mask = bg_on ? _mm_set1_epi16(-1) : zero;
+		const __m128i vpri0 = _mm_set1_epi16(pri0);
+		const __m128i vpri1 = _mm_set1_epi16(pri1);
+
+		for (; i + 8 <= nPixels; i += 8)
 		{
-			if (pri[i] == prio) {
-				dest[i] = src[i];
-			}
+			__m128i p = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(pri + i)), zero);
+			__m128i s = _mm_loadu_si128((const __m128i*)(spr + i));
+			__m128i b = _mm_loadu_si128((const __m128i*)(pBgDraw + i));
+
+			__m128i m = _mm_cmpeq_epi16(p, vpri1);
+			__m128i r = _mm_or_si128(_mm_and_si128(m, s), _mm_andnot_si128(m, backdrop));
+
+			m = _mm_andnot_si128(_mm_cmpeq_epi16(b, bg_trans), bg_mask);
+			r = _mm_or_si128(_mm_and_si128(m, b), _mm_andnot_si128(m, r));
+
+			m = _mm_cmpeq_epi16(p, vpri0);
+			r = _mm_or_si128(_mm_and_si128(m, s), _mm_andnot_si128(m, r));
+
+			_mm_storeu_si128((__m128i*)(dest + i), r);
+		}
+#endif
+
+		for (; i < nPixels; i++)
+		{
+			UINT16 pxl = 0x900;
+
+			if (pri[i] == pri1) pxl = spr[i];
+			if (bg_on && pBgDraw[i] != BG_TRANSPARENT) pxl = pBgDraw[i];
+			if (pri[i] == pri0) pxl = spr[i];
+
+			dest[i] = pxl;
 		}
 	}
 }
@@ -842,7 +1056,7 @@ static void draw_background()
 				UINT8 *gfx = PGMTileROMExp + (code * 0x400);
 				INT32 flip = (flipx ? 0x1f : 0) | (flipy ? 0x3e0 : 0);
 				UINT32 *pal = RamCurPal + color * 0x20;
-				UINT32 *dst = pTempDraw32 + (sy * nScreenWidth) + sx;
+				UINT32 *dst = pBgDraw32 + (sy * nScreenWidth) + sx;
 	
 				for (INT32 y = 0; y < 32; y++, dst += nScreenWidth) {
 					if ((sy+y) >= 0 && (sy+y)<nScreenHeight) {
@@ -865,29 +1079,29 @@ static void draw_background()
 					if (tiletrans[code] & 2) { // opaque
 						if (flipy) {
 							if (flipx) {
-								Render32x32Tile_FlipXY_Clip(pTransDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
+								Render32x32Tile_FlipXY_Clip(pBgDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
 							} else {
-								Render32x32Tile_FlipY_Clip(pTransDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
+								Render32x32Tile_FlipY_Clip(pBgDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
 							}
 						} else {
 							if (flipx) {
-								Render32x32Tile_FlipX_Clip(pTransDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
+								Render32x32Tile_FlipX_Clip(pBgDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
 							} else {
-								Render32x32Tile_Clip(pTransDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
+								Render32x32Tile_Clip(pBgDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
 							}
 						}
 					} else {
 						if (flipy) {
 							if (flipx) {
-								Render32x32Tile_Mask_FlipXY_Clip(pTransDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
+								Render32x32Tile_Mask_FlipXY_Clip(pBgDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
 							} else {
-								Render32x32Tile_Mask_FlipY_Clip(pTransDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
+								Render32x32Tile_Mask_FlipY_Clip(pBgDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
 							}
 						} else {
 							if (flipx) {
-								Render32x32Tile_Mask_FlipX_Clip(pTransDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
+								Render32x32Tile_Mask_FlipX_Clip(pBgDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
 							} else {
-								Render32x32Tile_Mask_Clip(pTransDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
+								Render32x32Tile_Mask_Clip(pBgDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
 							}
 						}
 					}
@@ -897,29 +1111,29 @@ static void draw_background()
 					if (tiletrans[code] & 2) { // opaque
 						if (flipy) {
 							if (flipx) {
-								Render32x32Tile_FlipXY(pTransDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
+								Render32x32Tile_FlipXY(pBgDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
 							} else {
-								Render32x32Tile_FlipY(pTransDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
+								Render32x32Tile_FlipY(pBgDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
 							}
 						} else {
 							if (flipx) {
-								Render32x32Tile_FlipX(pTransDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
+								Render32x32Tile_FlipX(pBgDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
 							} else {
-								Render32x32Tile(pTransDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
+								Render32x32Tile(pBgDraw, code, sx, sy, color, 5, 0, PGMTileROMExp);
 							}
 						}
 					} else {
 						if (flipy) {
 							if (flipx) {
-								Render32x32Tile_Mask_FlipXY(pTransDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
+								Render32x32Tile_Mask_FlipXY(pBgDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
 							} else {
-								Render32x32Tile_Mask_FlipY(pTransDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
+								Render32x32Tile_Mask_FlipY(pBgDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
 							}
 						} else {
 							if (flipx) {
-								Render32x32Tile_Mask_FlipX(pTransDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
+								Render32x32Tile_Mask_FlipX(pBgDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
 							} else {
-								Render32x32Tile_Mask(pTransDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
+								Render32x32Tile_Mask(pBgDraw, code, sx, sy, color, 5, 0x1f, 0, PGMTileROMExp);
 							}
 						}
 					}
@@ -956,7 +1170,7 @@ static void draw_background()
 
 			if (enable_blending)
 			{
-				UINT32 *dst = pTempDraw32 + (y * nScreenWidth);
+				UINT32 *dst = pBgDraw32 + (y * nScreenWidth);
 				UINT32 *pal = RamCurPal + color;
 	
 				if (sx >= 0 && sx <= 415) {
@@ -980,7 +1194,7 @@ static void draw_background()
 					}
 				}
 			} else {
-				UINT16 *dst = pTransDraw + (y * nScreenWidth);
+				UINT16 *dst = pBgDraw + (y * nScreenWidth);
 
 				if (sx >= 0 && sx <= 415) {
 					for (INT32 xx = 0; xx < 32; xx++, sx++) {
@@ -1018,6 +1232,29 @@ static void pgmBlendCopy()
 	}
 }
 
+static void pgm_draw_layer(INT32 nIndex, void *)
+{
+	INT32 nPixels = nScreenWidth * nScreenHeight;
+
+	if (nIndex == 0)
+	{
+		memset (pTempScreen, 0, nPixels * sizeof(UINT16));
+		memset (SpritePrio, 0xff, nPixels);
+
+		pgm_drawsprites();
+	}
+	else if (nBurnLayer & 1)
+	{
+		if (enable_blending) {
+			memset (pBgDraw32, 0xff, nPixels * sizeof(UINT32));
+		} else {
+			memset (pBgDraw, 0xff, nPixels * sizeof(UINT16));
+		}
+
+		draw_background();
+	}
+}
+
 INT32 pgmDraw()
 {
 	if (enable_blending) nPgmPalRecalc = 1; // force recalc.
@@ -1035,26 +1272,12 @@ INT32 pgmDraw()
 		RamCurPal[0x1202/2] = BurnHighCol(0xff,0x00,0xff,0);
 	}
 
-	// Fill in background color (0x1200/2)
-	// also, clear buffers
-	{
+	// sprites and background don't touch each other's buffers, draw them side by side
+	BurnThreadRun(pgm_draw_layer, 2, NULL);
 
-		for (INT32 i = 0; i < nScreenWidth * nScreenHeight; i++) {
-			pTempDraw32[i] = RamCurPal[0x900];
-			pTransDraw[i] = 0x900;
-			pTempScreen[i] = 0;
-			SpritePrio[i] = 0xff;
-		}
-	}
-
-	pgm_drawsprites();
-	if (nSpriteEnable & 1) copy_sprite_priority(1);
+	pgm_composite();
 #ifdef DRAW_SPRITE_NUMBER
 	pgm_drawsprites_fonts(1);
-#endif
-	if (nBurnLayer & 1) draw_background();
-	if (nSpriteEnable & 2) copy_sprite_priority(0);
-#ifdef DRAW_SPRITE_NUMBER
 	pgm_drawsprites_fonts(0);
 #endif
 	if (nBurnLayer & 2) draw_text();
@@ -1140,12 +1363,27 @@ void pgmInitDraw() // preprocess some things...
 	GenericTilesInit();
 
 	pTempDraw32 = (UINT32*)BurnMalloc(0x448 * 0x224 * 4);
-	pTempDraw = (UINT16*)BurnMalloc(0x400 * 0x200 * sizeof(INT16));
+	pTempDraw = (UINT8*)BurnMalloc(0x400 * 0x200);
 	SpritePrio = (UINT8*)BurnMalloc(nScreenWidth * nScreenHeight);
 	pTempScreen = (UINT16*)BurnMalloc(nScreenWidth * nScreenHeight * sizeof(INT16));
+	pBgDraw32 = (UINT32*)BurnMalloc(nScreenWidth * nScreenHeight * sizeof(UINT32));
+	pBgDraw = (UINT16*)pBgDraw32;
 
 	if (bBurnUseBlend) pgmBlendInit();
 
+	// decoded sprite cache, as big as we can get up to the size of the sprite roms
+	{
+		nSpriteCacheSize = SPRCACHE_MAX_SIZE;
+		while (nSpriteCacheSize > SPRCACHE_MIN_SIZE && nSpriteCacheSize / 2 >= nPGMSPRColMaskLen) nSpriteCacheSize >>= 1;
+
+		for (; nSpriteCacheSize >= SPRCACHE_MIN_SIZE; nSpriteCacheSize >>= 1) {
+			pSpriteCache = (UINT8*)BurnMalloc(nSpriteCacheSize);
+			if (pSpriteCache) break;
+		}
+
+		sprite_cache_reset();
+	}
+
 	// Find transparent tiles so we can skip them
 	{
 		nTileMask = ((nPGMTileROMLen / 5) * 8) / 0x400; // also used to set max. tile
@@ -1205,9 +1443,12 @@ void pgmExitDraw()
 
 	BurnFree (pTempDraw32);
 	BurnFree (pTempDraw);
+	BurnFree (pSpriteCache);
 	BurnFree (tiletrans);
 	BurnFree (texttrans);
 	BurnFree (pTempScreen);
+	BurnFree (pBgDraw32);
+	pBgDraw = NULL;
 	BurnFree (SpritePrio);
 
 	if (pSpriteBlendTable) {
@@ -3,6 +3,7 @@
 #include "v3021.h"
 #include "ics2115.h"
 #include "timer.h"
+#include "burn_cache.h"
 
 UINT8 PgmJoy1[8] = {0,0,0,0,0,0,0,0};
 UINT8 PgmJoy2[8] = {0,0,0,0,0,0,0,0};
@@ -69,6 +70,9 @@ INT32 pgm_cave_refresh = 0;
 
 #define	PGM_INTER_LEAVE	200
 
+// version of the cached expanded sprite colour data (burn_cache.h), bump when its decode changes
+#define PGM_CACHE_VERSION	1
+
 #define M68K_CYCS_PER_INTER	(M68K_CYCS_PER_FRAME / PGM_INTER_LEAVE)
 #define ARM7_CYCS_PER_INTER	(ARM7_CYCS_PER_FRAME / PGM_INTER_LEAVE)
 #define Z80_CYCS_PER_INTER	(Z80_CYCS_PER_FRAME  / PGM_INTER_LEAVE)
@@ -609,6 +613,9 @@ static void expand_colourdata()
 		nPGMSPRColMaskLen -= 1;
 	}
 
+	// expanded on a previous start
+	if (BurnCacheLoad("sprcol", PGM_CACHE_VERSION, PGMSPRColROM, (nPGMSPRColROMLen / 2) * 3) == 0) return;
+
 	UINT8 *tmp = (UINT8*)BurnMalloc(nPGMSPRColROMLen);
 	if (tmp == NULL) return;
 
@@ -663,6 +670,8 @@ static void expand_colourdata()
 	}
 
 	BurnFree (tmp);
+
+	BurnCacheSave("sprcol", PGM_CACHE_VERSION, PGMSPRColROM, (nPGMSPRColROMLen / 2) * 3);
 }
 
 static void ics2115_sound_irq(INT32 nState)
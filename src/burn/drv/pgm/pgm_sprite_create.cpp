@@ -2,16 +2,16 @@
 
 int main(int argc, char *argv[])
 {
-	printf ("typedef INT32 (*sprite_draw_function)(UINT16 *dest, UINT8 *adata, INT32 pal);\n");
+	printf ("typedef INT32 (*sprite_draw_function)(UINT8 *dest, UINT8 *adata);\n");
 	printf ("typedef INT32 (*sprite_draw_nozoom_function)(UINT16 *dest, UINT8 *pdest, UINT8 *adata, INT32 pal, INT32 pri);\n\n");
 
 	int i,j;
 	for (i = 0; i < 0x100; i++)
 	{
 		if (i == 0xff)
-			printf ("static INT32 zoom_draw_%2.2x(UINT16 *dest, UINT8 *, INT32 )\n", i);
+			printf ("static INT32 zoom_draw_%2.2x(UINT8 *dest, UINT8 *)\n", i);
 		else
-			printf ("static INT32 zoom_draw_%2.2x(UINT16 *dest, UINT8 *adata, INT32 pal)\n", i);
+			printf ("static INT32 zoom_draw_%2.2x(UINT8 *dest, UINT8 *adata)\n", i);
 
 		printf ("{\n");
 
@@ -21,11 +21,11 @@ int main(int argc, char *argv[])
 		{
 			if (i & (1 << j))
 			{
-				printf ("\tdest[%d] = 0x8000;\n", j);
+				printf ("\tdest[%d] = 0xff;\n", j);
 			}
 			else
 			{
-				printf ("\tdest[%d] = adata[%d] + pal;\n", j, cntr);
+				printf ("\tdest[%d] = adata[%d];\n", j, cntr);
 				cntr++;
 			}
 		}
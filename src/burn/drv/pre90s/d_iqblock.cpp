@@ -171,11 +171,13 @@ static void __fastcall iqblock_write_port(UINT16 address, UINT8 data)
 
 	if ((address & 0xfe00) == 0x6800) {
 		DrvFgRAM[address & 0x1ff] = data;
+		GenericTilemapSetTileDirty(1, address & 0x1ff);
 		return;
 	}
 
 	if ((address & 0xf000) == 0x7000) {
 		DrvBgRAM[address & 0xfff] = data;
+		GenericTilemapSetTileDirty(0, address & 0x7ff);
 		return;
 	}
 
@@ -273,6 +275,9 @@ static INT32 DrvDoReset()
 {
 	memset (AllRam, 0, RamEnd - AllRam);
 
+	GenericTilemapAllTilesDirty(0);
+	GenericTilemapAllTilesDirty(1);
+
 	ZetOpen(0);
 	ZetReset();
 	ZetClose();
@@ -385,6 +390,8 @@ static INT32 DrvInit(void (*decode)(), UINT16 prot_address, INT32 video_type)
 	GenericTilemapSetGfx(1, DrvGfxROM1, 4, 8, 32, 0x008000, 0, 0x3);
 	GenericTilemapSetTransparent(0, 0);
 	GenericTilemapSetScrollCols(1, 64);
+	GenericTilemapUseCache(0);		// the tile ram is only written through iqblock_write_port()
+	GenericTilemapUseCache(1);
 
 	DrvDoReset();
 
@@ -529,6 +536,11 @@ static INT32 DrvScan(INT32 nAction, INT32 *pnMin)
 		SCAN_VAR(video_enable);
 	}
 
+	if (nAction & ACB_WRITE) {
+		GenericTilemapAllTilesDirty(0);
+		GenericTilemapAllTilesDirty(1);
+	}
+
 	return 0;
 }
 
@@ -15,7 +15,7 @@ static UINT8 *RamEnd;
 static UINT8 *MemEnd;
 static UINT8 *Drv68KROM;
 static UINT8 *DrvPICROM;
-static UINT8 *DrvGfxROM[4];
+static UINT8 *DrvGfxROM;
 static UINT8 *DrvSndROM;
 static UINT8 *DrvEEPROM;
 static UINT8 *Drv68KRAM;
@@ -341,10 +341,7 @@ static INT32 MemIndex()
 	Drv68KROM		= Next; Next += 0x100000;
 	DrvPICROM		= Next; Next += 0x010000;
 
-	DrvGfxROM[0]	= Next; Next += 0x400000;
-	DrvGfxROM[1]	= Next; Next += 0x800000;
-	DrvGfxROM[2]	= Next; Next += 0x800000;
-	DrvGfxROM[3]	= Next; Next += 0x400000;
+	DrvGfxROM		= Next; Next += 0x400000;
 
 	MSM6295ROM		= Next;
 	DrvSndROM		= Next; Next += 0x080000;
@@ -370,7 +367,8 @@ static INT32 MemIndex()
 	return 0;
 }
 
-static INT32 DrvGfxDecode(INT32 length, INT32 type)
+// the tiles are decoded as they're drawn, DrvGfxROM stays as loaded.  called after CommonInit()
+static void DrvGfxDecode(INT32 length, INT32 type)
 {
 	INT32 Plane[4]   = { RGN_FRAC(length, 3, 4), RGN_FRAC(length, 2, 4), RGN_FRAC(length, 1, 4), RGN_FRAC(length, 0, 4) };
 	INT32 XOffs[32]  = { STEP32(0,1) };
@@ -378,29 +376,22 @@ static INT32 DrvGfxDecode(INT32 length, INT32 type)
 	INT32 YOffs1[16] = { STEP16(0,16) };
 	INT32 YOffs2[32] = { STEP32(0,32) };
 
-	UINT8 *tmp = (UINT8*)BurnMalloc(length);
-	if (tmp == NULL) {
-		return 1;
-	}
-
-	memcpy (tmp, DrvGfxROM[1], length);
-
 	if (type == 0) // kickgoal
 	{
-		GfxDecode(0x08000, 4,  8,  8, Plane, XOffs, YOffs1, 0x080, tmp + 0, DrvGfxROM[0]);
-		GfxDecode(0x04000, 4, 16, 16, Plane, XOffs, YOffs1, 0x100, tmp + 0, DrvGfxROM[1]);
-		GfxDecode(0x01000, 4, 32, 32, Plane, XOffs, YOffs2, 0x400, tmp + 0, DrvGfxROM[2]);
-		GfxDecode(0x08000, 4,  8,  8, Plane, XOffs, YOffs1, 0x080, tmp + 1, DrvGfxROM[3]);
+		GenericTilesSetGfxLazy(0, DrvGfxROM + 0x070000, 0x1000, 4,  8,  8, Plane, XOffs, YOffs1, 0x080, 0x000, 0x0f); // fg - bank0
+		GenericTilesSetGfxLazy(1, DrvGfxROM + 0x020000, 0x1000, 4, 16, 16, Plane, XOffs, YOffs1, 0x100, 0x100, 0x0f); // bg0
+		GenericTilesSetGfxLazy(2, DrvGfxROM + 0x040000, 0x0800, 4, 32, 32, Plane, XOffs, YOffs2, 0x400, 0x200, 0x0f); // bg1
+		GenericTilesSetGfxLazy(3, DrvGfxROM + 0x000000, 0x4000, 4, 16, 16, Plane, XOffs, YOffs1, 0x100, 0x300, 0x0f); // sprite
+		GenericTilesSetGfxLazy(4, DrvGfxROM + 0x070001, 0x1000, 4,  8,  8, Plane, XOffs, YOffs1, 0x080, 0x000, 0x0f); // fg - bank 1
 	}
 	else // actionhw
 	{
-		GfxDecode(((length * 8)/4)/(8 * 8),   4,  8,  8, Plane, XOffs, YOffs0, 0x040, tmp, DrvGfxROM[0]);
-		GfxDecode(((length * 8)/4)/(16 * 16), 4, 16, 16, Plane, XOffs, YOffs1, 0x100, tmp, DrvGfxROM[1]);
+		GenericTilesSetGfxLazy(0, DrvGfxROM + 0x070000, 0x1000, 4,  8,  8, Plane, XOffs, YOffs0, 0x040, 0x000, 0x0f); // fg
+		GenericTilesSetGfxLazy(1, DrvGfxROM + 0x000000, 0x2000, 4, 16, 16, Plane, XOffs, YOffs1, 0x100, 0x100, 0x0f); // bg0
+		GenericTilesSetGfxLazy(2, DrvGfxROM + 0x040000, 0x2000, 4, 16, 16, Plane, XOffs, YOffs1, 0x100, 0x200, 0x0f); // bg1
+		GenericTilesSetGfxLazy(3, DrvGfxROM + 0x080000, 0x4000, 4, 16, 16, Plane, XOffs, YOffs1, 0x100, 0x300, 0x0f); // sprite
+		GenericTilesSetGfxLazy(4, DrvGfxROM + 0x070000, 0x1000, 4,  8,  8, Plane, XOffs, YOffs0, 0x040, 0x000, 0x0f); // fg (mirror 0)
 	}
-
-	BurnFree (tmp);
-
-	return 0;
 }
 
 static void CommonInit(INT32 mcu, INT32 msm_pin, INT32 bg1_size, INT32 x_adjust, INT32 y_adjust)
@@ -458,18 +449,16 @@ static INT32 ActionhwInit()
 		BurnLoadRom(DrvPICROM    + 0x000000, k++, 1);
 
 
-		if (BurnLoadRom(DrvGfxROM[1] + 0x000000, k++, 1)) return 1;
-		if (BurnLoadRom(DrvGfxROM[1] + 0x080000, k++, 1)) return 1;
-		if (BurnLoadRom(DrvGfxROM[1] + 0x100000, k++, 1)) return 1;
-		if (BurnLoadRom(DrvGfxROM[1] + 0x180000, k++, 1)) return 1;
-		if (BurnLoadRom(DrvGfxROM[1] + 0x200000, k++, 1)) return 1;
-		if (BurnLoadRom(DrvGfxROM[1] + 0x280000, k++, 1)) return 1;
-		if (BurnLoadRom(DrvGfxROM[1] + 0x300000, k++, 1)) return 1;
-		if (BurnLoadRom(DrvGfxROM[1] + 0x380000, k++, 1)) return 1;
+		if (BurnLoadRom(DrvGfxROM    + 0x000000, k++, 1)) return 1;
+		if (BurnLoadRom(DrvGfxROM    + 0x080000, k++, 1)) return 1;
+		if (BurnLoadRom(DrvGfxROM    + 0x100000, k++, 1)) return 1;
+		if (BurnLoadRom(DrvGfxROM    + 0x180000, k++, 1)) return 1;
+		if (BurnLoadRom(DrvGfxROM    + 0x200000, k++, 1)) return 1;
+		if (BurnLoadRom(DrvGfxROM    + 0x280000, k++, 1)) return 1;
+		if (BurnLoadRom(DrvGfxROM    + 0x300000, k++, 1)) return 1;
+		if (BurnLoadRom(DrvGfxROM    + 0x380000, k++, 1)) return 1;
 
 		if (BurnLoadRom(DrvSndROM    + 0x000000, k++, 1)) return 1;
-
-		DrvGfxDecode(0x400000, 1);
 	}
 
 	actionhw_mode = 1;
@@ -477,11 +466,7 @@ static INT32 ActionhwInit()
 
 	CommonInit(0, MSM6295_PIN7_HIGH, 0, 82, 0);
 
-	GenericTilemapSetGfx(0, DrvGfxROM[0] + 0x380000, 4,  8,  8, 0x040000, 0x000, 0x0f); // fg
-	GenericTilemapSetGfx(1, DrvGfxROM[1] + 0x000000, 4, 16, 16, 0x200000, 0x100, 0x0f); // bg0
-	GenericTilemapSetGfx(2, DrvGfxROM[1] + 0x200000, 4, 16, 16, 0x200000, 0x200, 0x0f); // bg1
-	GenericTilemapSetGfx(3, DrvGfxROM[1] + 0x400000, 4, 16, 16, 0x400000, 0x300, 0x0f); // sprite
-	GenericTilemapSetGfx(4, DrvGfxROM[0] + 0x380000, 4,  8,  8, 0x040000, 0x000, 0x0f); // fg (mirror 0)
+	DrvGfxDecode(0x400000, 1);
 
 	DrvDoReset();
 
@@ -501,23 +486,17 @@ static INT32 KickgoalCommonInit()
 
 		if (BurnLoadRom(DrvEEPROM    + 0x000000, k++, 1)) return 1;
 
-		if (BurnLoadRom(DrvGfxROM[1] + 0x000000, k++, 1)) return 1;
-		if (BurnLoadRom(DrvGfxROM[1] + 0x080000, k++, 1)) return 1;
-		if (BurnLoadRom(DrvGfxROM[1] + 0x100000, k++, 1)) return 1;
-		if (BurnLoadRom(DrvGfxROM[1] + 0x180000, k++, 1)) return 1;
+		if (BurnLoadRom(DrvGfxROM    + 0x000000, k++, 1)) return 1;
+		if (BurnLoadRom(DrvGfxROM    + 0x080000, k++, 1)) return 1;
+		if (BurnLoadRom(DrvGfxROM    + 0x100000, k++, 1)) return 1;
+		if (BurnLoadRom(DrvGfxROM    + 0x180000, k++, 1)) return 1;
 
 		if (BurnLoadRom(DrvSndROM    + 0x000000, k++, 1)) return 1;
-
-		DrvGfxDecode(0x200000, 0);
 	}
 
 	CommonInit(1, MSM6295_PIN7_LOW, 1, 72, 16);
 
-	GenericTilemapSetGfx(0, DrvGfxROM[0] + 0x1c0000, 4,  8,  8, 0x040000, 0x000, 0x0f); // fg - bank0
-	GenericTilemapSetGfx(1, DrvGfxROM[1] + 0x100000, 4, 16, 16, 0x100000, 0x100, 0x0f); // bg0
-	GenericTilemapSetGfx(2, DrvGfxROM[2] + 0x200000, 4, 32, 32, 0x200000, 0x200, 0x0f); // bg1
-	GenericTilemapSetGfx(3, DrvGfxROM[1] + 0x000000, 4, 16, 16, 0x400000, 0x300, 0x0f); // sprite
-	GenericTilemapSetGfx(4, DrvGfxROM[3] + 0x1c0000, 4,  8,  8, 0x040000, 0x000, 0x0f); // fg - bank 1
+	DrvGfxDecode(0x200000, 0);
 
 	DrvDoReset();
 
@@ -4,6 +4,11 @@
 #include "taitof3_video.h"
 #include "taito.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define F3_SSE2
+#include <emmintrin.h>
+#endif
+
 UINT32 sprite_lag;
 UINT32 extended_layers;
 
@@ -600,97 +605,34 @@ static void f3_drawgfxzoom(
 {
 	pri_dst=1<<pri_dst;
 
-	/* KW 991012 -- Added code to force clip to bitmap boundary */
-//	myclip = clip;
-//	myclip &= dest_bmp.cliprect();
-
+	const UINT32 *pal = TaitoPalette + (0x1000 + ((color & 0xff) << 4));
+	const UINT8 *code_base = TaitoSpritesA + code * 0x100;
 
-	{
-		const UINT32 *pal = TaitoPalette + (0x1000 + ((color & 0xff) << 4));
-		const UINT8 *code_base = TaitoSpritesA + code * 0x100;
-
-		{
-			/* compute sprite increment per screen pixel */
-			INT32 dx = (16<<16)/scalex;
-			INT32 dy = (16<<16)/scaley;
+	/* clip (or cull) once, and get the source column of every visible pixel */
+	GenericZoomSpan span;
 
-			INT32 ex = sx+scalex;
-			INT32 ey = sy+scaley;
+	if (GenericZoomSpanInit(&span, sx, sy, scalex, scaley, (16<<16)/scalex, (16<<16)/scaley, flipx, flipy, min_x, max_x + 1, min_y, max_y + 1) == 0) {
+		return;
+	}
 
-			INT32 x_index_base;
-			INT32 y_index;
+	INT32 width = span.x1 - span.x0;
 
-			if( flipx )
-			{
-				x_index_base = (scalex-1)*dx;
-				dx = -dx;
-			}
-			else
-			{
-				x_index_base = 0;
-			}
+	for (INT32 y = span.y0, y_index = span.y_index; y < span.y1; y++, y_index += span.dy)
+	{
+		const UINT8 *source = code_base + (y_index>>16) * 16;
+		UINT32 *dest = output_bitmap + y * 512 + span.x0;
+		UINT8 *pri = TaitoPriorityMap + y * 1024 + span.x0;
 
-			if( flipy )
-			{
-				y_index = (scaley-1)*dy;
-				dy = -dy;
-			}
-			else
+		for (INT32 x = 0; x < width; x++)
+		{
+			INT32 c = source[span.xtab[x]] & sprite_pen_mask;
+			if(c)
 			{
-				y_index = 0;
-			}
-
-			if(sx < min_x)
-			{ /* clip left */
-				INT32 pixels = min_x-sx;
-				sx += pixels;
-				x_index_base += pixels*dx;
-			}
-			if( sy < min_y )
-			{ /* clip top */
-				INT32 pixels = min_y-sy;
-				sy += pixels;
-				y_index += pixels*dy;
-			}
-			/* NS 980211 - fixed incorrect clipping */
-			if( ex > max_x+1 )
-			{ /* clip right */
-				INT32 pixels = ex-max_x-1;
-				ex -= pixels;
-			}
-			if( ey > max_y+1 )
-			{ /* clip bottom */
-				INT32 pixels = ey-max_y-1;
-				ey -= pixels;
-			}
-
-			if( ex>sx )
-			{ /* skip if inner loop doesn't draw anything */
+				UINT8 p=pri[x];
+				if (p == 0 || p == 0xff)
 				{
-					INT32 y;
-					for( y=sy; y<ey; y++ )
-					{
-						const UINT8 *source = code_base + (y_index>>16) * 16;
-						UINT32 *dest = output_bitmap + y * 512;
-						UINT8 *pri = TaitoPriorityMap + y * 1024;
-
-						INT32 x, x_index = x_index_base;
-						for( x=sx; x<ex; x++ )
-						{
-							INT32 c = source[x_index>>16] & sprite_pen_mask;
-							if(c)
-							{
-								UINT8 p=pri[x];
-								if (p == 0 || p == 0xff)
-								{
-									dest[x] = pal[c];
-									pri[x] = pri_dst;
-								}
-							}
-							x_index += dx;
-						}
-						y_index += dy;
-					}
+					dest[x] = pal[c];
+					pri[x] = pri_dst;
 				}
 			}
 		}
@@ -1487,6 +1429,238 @@ static void init_alpha_blend_func()
 
 /******************************************************************************/
 
+/* Specialised compositor for the two common line setups: every layer opaque
+   (nBlend 0), or one translucent layer in a plain 2a/3a/2b/3b mode (nBlend is
+   its m_dpix_n row) with no sprite alpha.  The blend levels are resolved once
+   per call and each layer is fetched into a clipped span first, so the pixel
+   loop has no m_dpix_lp / m_dpix_sp indirection and no per-pixel clip tests.
+   The results match draw_scanlines(), which still handles everything else. */
+
+static inline UINT32 f3_alpha_blend32_sv(INT32 alphas, UINT32 s, UINT32 d)
+{
+	return (d & 0xff000000) |
+		((((s >> 16) & 0xff) * alphas >> 8) << 16) |
+		((((s >>  8) & 0xff) * alphas >> 8) <<  8) |
+		(( (s        & 0xff) * alphas >> 8)      );
+}
+
+static inline UINT32 f3_alpha_blend32_dv(INT32 alphas, UINT32 s, UINT32 d)
+{
+	return (d & 0xff000000) |
+		(m_add_sat[(d >> 16) & 0xff][((s >> 16) & 0xff) * alphas >> 8] << 16) |
+		(m_add_sat[(d >>  8) & 0xff][((s >>  8) & 0xff) * alphas >> 8] <<  8) |
+		(m_add_sat[ d        & 0xff][( s        & 0xff) * alphas >> 8]      );
+}
+
+/* fetch one scanline of a playfield into pen / opacity spans, with the clip windows applied */
+static void f3_fetch_layer_line(const struct f3_playfield_line_inf *line_tmp, INT32 y, INT32 xsize, UINT16 *pix, UINT8 *opq)
+{
+	const UINT16 *src=line_tmp->src[y];
+	const UINT16 *src_s=line_tmp->src_s[y];
+	const UINT16 *src_e=line_tmp->src_e[y];
+	const UINT8 *tsrc=line_tmp->tsrc[y];
+	const UINT8 *tsrc_s=line_tmp->tsrc_s[y];
+	UINT32 x_count=line_tmp->x_count[y];
+	const UINT32 x_zoom=line_tmp->x_zoom[y];
+	INT32 cx=0;
+
+	if (x_zoom==0x10000)
+	{
+		/* unzoomed, one source pixel per pixel up to each wrap */
+		while (cx<xsize && src<src_e)
+		{
+			INT32 n=src_e-src;
+			if (n>xsize-cx) n=xsize-cx;
+
+			memcpy(pix+cx,src,n*sizeof(UINT16));
+
+			INT32 k=0;
+#if defined F3_SSE2
+			const __m128i mask=_mm_set1_epi8((char)0xf0);
+			for (; k+16<=n; k+=16)
+				_mm_storeu_si128((__m128i*)(opq+cx+k),_mm_and_si128(_mm_loadu_si128((const __m128i*)(tsrc+k)),mask));
+#endif
+			for (; k<n; k++)
+				opq[cx+k]=tsrc[k]&0xf0;
+
+			cx+=n;
+			src=src_s;
+			tsrc=tsrc_s;
+		}
+	}
+
+	for (; cx<xsize; cx++)
+	{
+		pix[cx]=*src;
+		opq[cx]=*tsrc&0xf0;
+
+		x_count+=x_zoom;
+		if (x_count>>16)
+		{
+			x_count&=0xffff;
+			src++;
+			tsrc++;
+			if (src==src_e) {src=src_s; tsrc=tsrc_s;}
+		}
+	}
+
+	/* visible inside clip 0 (al .. ar-2), except inside clip 1 (bl .. br-1) */
+	const INT32 clip_al=line_tmp->clip0[y]&0xffff;
+	const INT32 clip_ar=(line_tmp->clip0[y]>>16)-1;
+	const INT32 clip_bl=line_tmp->clip1[y]&0xffff;
+	const INT32 clip_br=line_tmp->clip1[y]>>16;
+
+	if (clip_al>0) memset(opq,0,(clip_al<xsize ? clip_al : xsize));
+	if (clip_ar<xsize) memset(opq+(clip_ar>0 ? clip_ar : 0),0,xsize-(clip_ar>0 ? clip_ar : 0));
+	if (clip_bl<clip_br && clip_bl<xsize) memset(opq+clip_bl,0,(clip_br<xsize ? clip_br : xsize)-clip_bl);
+}
+
+template <INT32 nSkip, INT32 nBlend>
+static void draw_scanlines_fast(INT32 xsize,INT16 *draw_line_num,
+							const struct f3_playfield_line_inf **line_t,
+							const INT32 *sprite,
+							UINT32 orient,
+							INT32 blend_layer)
+{
+	UINT32 *clut = TaitoPalette;
+	const UINT32 bgcolor=clut[0];
+
+	/* level of the translucent layer, and the level everything behind it is added with */
+	INT32 alpha_s = 0, alpha_d = 0;
+	UINT8 pdest = 0;
+	switch (nBlend)
+	{
+		case 2: alpha_s = m_alpha_s_2a_0; alpha_d = m_alpha_s_1_1; pdest = m_pdest_2a; break;
+		case 3: alpha_s = m_alpha_s_3a_0; alpha_d = m_alpha_s_1_4; pdest = m_pdest_3a; break;
+		case 4: alpha_s = m_alpha_s_2b_0; alpha_d = m_alpha_s_1_2; pdest = m_pdest_2b; break;
+		case 5: alpha_s = m_alpha_s_3b_0; alpha_d = m_alpha_s_1_8; pdest = m_pdest_3b; break;
+	}
+
+	const INT32 x=46;
+
+	INT32 yadv = 512;
+	INT32 yadvp = 1024;
+	INT32 i=0,y=draw_line_num[0];
+	INT32 ty = y;
+
+	if (orient & ORIENTATION_FLIP_Y)
+	{
+		ty = 512 - 1 - ty;
+		yadv = -yadv;
+		yadvp = -yadvp;
+	}
+
+	UINT32 *dsti0 = output_bitmap + (ty * 512) + x;
+	UINT8 *dstp0 = TaitoPriorityMap + (ty * 1024) + x;
+	UINT32 dval = m_dval;
+
+	UINT16 pix[5][512];
+	UINT8 opq[5][512];
+	UINT8 spm[512];
+
+	if (xsize > 512) xsize = 512;
+
+	while (1)
+	{
+		for (INT32 l = nSkip; l < 5; l++)
+			f3_fetch_layer_line(line_t[l], y, xsize, pix[l], opq[l]);
+
+		{
+			const INT32 clip_als=m_sa_line_inf[0].sprite_clip0[y]&0xffff;
+			const INT32 clip_ars=(m_sa_line_inf[0].sprite_clip0[y]>>16)-1;
+			const INT32 clip_bls=m_sa_line_inf[0].sprite_clip1[y]&0xffff;
+			const INT32 clip_brs=m_sa_line_inf[0].sprite_clip1[y]>>16;
+
+			memset(spm,0x0f,xsize);
+			if (clip_als>0) memset(spm,0,(clip_als<xsize ? clip_als : xsize));
+			if (clip_ars<xsize) memset(spm+(clip_ars>0 ? clip_ars : 0),0,xsize-(clip_ars>0 ? clip_ars : 0));
+			if (clip_bls<clip_brs && clip_bls<xsize) memset(spm+clip_bls,0,(clip_brs<xsize ? clip_brs : xsize)-clip_bls);
+		}
+
+		UINT32 *dsti = dsti0;
+		const UINT8 *dstp = dstp0;
+
+		for (INT32 cx = 0; cx < xsize; cx++)
+		{
+			UINT8 pval=dstp[cx];
+			if (pval==0xff) continue;
+
+			const INT32 spv=pval&spm[cx];
+			INT32 l;
+
+			for (l = nSkip; l < 5; l++)
+			{
+				if (sprite[l]&spv)
+				{
+					if ((sprite[l]&0x100) || !(pval&0xf0)) break;
+					if (dsti[cx]) dval = f3_alpha_blend32_dv(alpha_d, dsti[cx], dval);
+					dsti[cx]=dval;
+					break;
+				}
+
+				if (opq[l][cx])
+				{
+					UINT32 s_pix = clut[pix[l][cx]];
+
+					if (nBlend == 0 || l < blend_layer)
+					{
+						dval = s_pix;
+					}
+					else if (l == blend_layer)
+					{
+						dval = s_pix ? f3_alpha_blend32_sv(alpha_s, s_pix, dval) : 0;
+						if (pdest) {pval|=pdest;continue;}
+					}
+					else if (pval&0xf0)
+					{
+						if (s_pix) dval = f3_alpha_blend32_dv(alpha_d, s_pix, dval);
+					}
+					else
+					{
+						dval = s_pix;
+					}
+
+					dsti[cx]=dval;
+					break;
+				}
+			}
+
+			if (l < 5) continue;
+
+			if (sprite[5]&spv)
+			{
+				if ((sprite[5]&0x100) || !(pval&0xf0)) continue;
+				if (dsti[cx]) dval = f3_alpha_blend32_dv(alpha_d, dsti[cx], dval);
+				dsti[cx]=dval;
+				continue;
+			}
+
+			if (!bgcolor) {if (!(pval&0xf0)) {dsti[cx]=0;continue;}}
+			else if (!(pval&0xf0)) dval = bgcolor;
+			else dval = f3_alpha_blend32_dv(alpha_d, bgcolor, dval);
+			dsti[cx]=dval;
+		}
+
+		i++;
+		if(draw_line_num[i]<0) break;
+		dsti0 += (draw_line_num[i]-y)*yadv;
+		dstp0 += (draw_line_num[i]-y)*yadvp;
+		y=draw_line_num[i];
+	}
+
+	m_dval = dval;
+}
+
+#define F3_SCANLINES_FAST(n) \
+	{ &draw_scanlines_fast<n,0>, &draw_scanlines_fast<n,2>, &draw_scanlines_fast<n,3>, &draw_scanlines_fast<n,4>, &draw_scanlines_fast<n,5> }
+
+/* [skip_layer_num][0 = opaque, else m_dpix_n row - 1] */
+static void (*const draw_scanlines_fast_tab[6][5])(INT32, INT16 *, const struct f3_playfield_line_inf **, const INT32 *, UINT32, INT32) = {
+	F3_SCANLINES_FAST(0), F3_SCANLINES_FAST(1), F3_SCANLINES_FAST(2),
+	F3_SCANLINES_FAST(3), F3_SCANLINES_FAST(4), F3_SCANLINES_FAST(5)
+};
+#undef F3_SCANLINES_FAST
+
 #define GET_PIXMAP_POINTER(pf_num) \
 { \
 	const struct f3_playfield_line_inf *line_tmp=line_t[pf_num]; \
@@ -1544,7 +1718,9 @@ static void draw_scanlines(INT32 xsize,INT16 *draw_line_num,
 							const struct f3_playfield_line_inf **line_t,
 							const INT32 *sprite,
 							UINT32 orient,
-							INT32 skip_layer_num)
+							INT32 skip_layer_num,
+							INT32 blend_row,
+							INT32 blend_layer)
 {
 	UINT32 *clut = TaitoPalette;
 	UINT32 bgcolor=clut[0];
@@ -1581,6 +1757,12 @@ static void draw_scanlines(INT32 xsize,INT16 *draw_line_num,
 	m_tr_3a =(m_f3_alpha_level_3as==0 && m_f3_alpha_level_3ad==255) ? -1 : 0;
 	m_tr_3b =(m_f3_alpha_level_3bs==0 && m_f3_alpha_level_3bd==255) ? -1 : 1;
 
+	if (blend_row >= 0)
+	{
+		draw_scanlines_fast_tab[skip_layer_num][blend_row ? blend_row - 1 : 0](xsize,draw_line_num,line_t,sprite,orient,blend_layer);
+		return;
+	}
+
 	{
 		UINT32 *dsti0,*dsti;
 		dsti0 = output_bitmap + (ty * 512) + x;
@@ -2220,6 +2402,7 @@ static void scanline_draw()
 		UINT8 sprite_alpha_all_2a;
 		INT32 spri;
 		INT32 alpha;
+		INT32 blend_row,blend_layer;
 		INT32 layer_tmp[5];
 		struct f3_playfield_line_inf *pf_line_inf = m_pf_line_inf;
 		struct f3_spritealpha_line_inf *sa_line_inf = m_sa_line_inf;
@@ -2558,6 +2741,8 @@ static void scanline_draw()
 
 		/* draw scanlines */
 		alpha=0;
+		blend_row=0;
+		blend_layer=5;
 		for(i=count_skip_layer;i<5;i++)
 		{
 			pos=layer_tmp[i]&7;
@@ -2571,6 +2756,9 @@ static void scanline_draw()
 				INT32 alpha_type=(((alpha_mode_flag[pos]>>4)&3)-1)*2;
 				m_dpix_lp[i]=m_dpix_n[alpha_mode[pos]+alpha_type];
 				alpha=1;
+
+				if(!blend_row) {blend_row=alpha_mode[pos]+alpha_type;blend_layer=i;}
+				else blend_row=-1;
 			}
 			else
 			{
@@ -2581,7 +2769,10 @@ static void scanline_draw()
 		if(sprite[5]&sprite_alpha_check) alpha=1;
 		else if(!alpha) sprite[5]|=0x100;
 
-		draw_scanlines(320,draw_line_num,line_t,sprite,rot,count_skip_layer);
+		/* opaque lines and lines with one plain translucent layer get the specialised compositor */
+		if(sprite_alpha_check || blend_row>5) blend_row=-1;
+
+		draw_scanlines(320,draw_line_num,line_t,sprite,rot,count_skip_layer,blend_row,blend_layer);
 		if(y_start<0) break;
 	}
 }
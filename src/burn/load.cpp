@@ -1,9 +1,10 @@
 // Burn - Rom Loading module
 #include "burnint.h"
+#include "burn_profile.h"
 
 // Load a rom and separate out the bytes by nGap
 // Dest is the memory block to insert the rom into
-INT32 BurnLoadRomExt(UINT8 *Dest, INT32 i, INT32 nGap, INT32 nFlags)
+static INT32 LoadRomExt(UINT8 *Dest, INT32 i, INT32 nGap, INT32 nFlags)
 {
 	INT32 nRet = 0, nLen = 0;
 	if (BurnExtLoadRom == NULL) return 1; // Load function was not defined by the application
@@ -95,6 +96,16 @@ INT32 BurnLoadRomExt(UINT8 *Dest, INT32 i, INT32 nGap, INT32 nFlags)
 	return 0;
 }
 
+// the profile phase only counts the copying / interleaving, the archive side has phases of its own
+INT32 BurnLoadRomExt(UINT8 *Dest, INT32 i, INT32 nGap, INT32 nFlags)
+{
+	BurnProfileBegin("BurnLoadRom");
+	INT32 nRet = LoadRomExt(Dest, i, nGap, nFlags);
+	BurnProfileEnd();
+
+	return nRet;
+}
+
 INT32 BurnLoadRom(UINT8 *Dest, INT32 i, INT32 nGap)
 {
 	return BurnLoadRomExt(Dest,i,nGap,0);
@@ -0,0 +1,126 @@
+// Pre-decoded ADPCM cache, see adpcm_cache.h
+
+#include "burnint.h"
+#include "adpcm_cache.h"
+
+struct AdpcmCacheEntry {
+	INT32 nType;
+	const UINT8 *pRom;
+	UINT32 nNibbles;
+	UINT32 nFingerprint;
+	UINT32 nLastUsed;
+	UINT8 *pData;					// nNibbles INT16 pcm values followed by nNibbles step indices
+};
+
+static struct AdpcmCacheEntry Entries[ADPCM_CACHE_ENTRIES];
+UINT32 nAdpcmCacheSerial[ADPCM_CACHE_ENTRIES];
+
+static UINT32 nCacheBytes = 0;
+static UINT32 nCacheClock = 0;
+
+// Cheap check that the data behind an entry hasn't been replaced (drivers that
+// bank by copying into the sample rom, Neo CD pcm ram, ...)
+static UINT32 AdpcmCacheFingerprint(const UINT8 *pRom, UINT32 nNibbles)
+{
+	UINT32 nBytes = (nNibbles + 1) >> 1;
+	UINT32 nStride = (nBytes > 32) ? (nBytes / 32) : 1;
+	UINT32 nHash = nNibbles * 0x9e3779b1;
+
+	for (UINT32 i = 0; i < nBytes; i += nStride) {
+		nHash = (nHash ^ pRom[i]) * 0x01000193;
+	}
+
+	return nHash ^ pRom[nBytes - 1];
+}
+
+static void AdpcmCacheFree(struct AdpcmCacheEntry *pEntry)
+{
+	if (pEntry->pData == NULL) return;
+
+	nCacheBytes -= pEntry->nNibbles * 3;
+	free(pEntry->pData);
+	pEntry->pData = NULL;
+
+	nAdpcmCacheSerial[pEntry - Entries]++;		// any channel still playing it falls back to the rom
+}
+
+INT32 AdpcmCacheEnabled()
+{
+	return (nBurnADPCMCacheSize > 0) ? 1 : 0;
+}
+
+INT32 AdpcmCacheFind(INT32 nType, const UINT8 *pRom, UINT32 nNibbles, INT16 **pPCM, UINT8 **pStep)
+{
+	for (INT32 i = 0; i < ADPCM_CACHE_ENTRIES; i++) {
+		struct AdpcmCacheEntry *pEntry = &Entries[i];
+
+		if (pEntry->pData == NULL || pEntry->pRom != pRom || pEntry->nNibbles != nNibbles || pEntry->nType != nType) continue;
+
+		if (pEntry->nFingerprint != AdpcmCacheFingerprint(pRom, nNibbles)) {
+			AdpcmCacheFree(pEntry);
+			return -1;
+		}
+
+		pEntry->nLastUsed = ++nCacheClock;
+		*pPCM = (INT16*)pEntry->pData;
+		*pStep = pEntry->pData + nNibbles * sizeof(INT16);
+
+		return i;
+	}
+
+	return -1;
+}
+
+// The caller decodes the sample into *pPCM / *pStep straight after this
+INT32 AdpcmCacheAlloc(INT32 nType, const UINT8 *pRom, UINT32 nNibbles, INT16 **pPCM, UINT8 **pStep)
+{
+	UINT32 nBudget = nBurnADPCMCacheSize * 1024;
+	UINT32 nSize = nNibbles * 3;
+
+	if (nNibbles == 0 || nSize > nBudget) return -1;
+
+	// evict least recently used entries until there is room
+	for (;;) {
+		struct AdpcmCacheEntry *pVictim = NULL;
+		struct AdpcmCacheEntry *pFree = NULL;
+
+		for (INT32 i = 0; i < ADPCM_CACHE_ENTRIES; i++) {
+			if (Entries[i].pData == NULL) {
+				if (pFree == NULL) pFree = &Entries[i];
+				continue;
+			}
+			if (pVictim == NULL || Entries[i].nLastUsed < pVictim->nLastUsed) pVictim = &Entries[i];
+		}
+
+		if (pFree && nCacheBytes + nSize <= nBudget) {
+			pFree->pData = (UINT8*)malloc(nSize);
+			if (pFree->pData == NULL) return -1;
+
+			pFree->nType = nType;
+			pFree->pRom = pRom;
+			pFree->nNibbles = nNibbles;
+			pFree->nFingerprint = AdpcmCacheFingerprint(pRom, nNibbles);
+			pFree->nLastUsed = ++nCacheClock;
+			nCacheBytes += nSize;
+
+			*pPCM = (INT16*)pFree->pData;
+			*pStep = pFree->pData + nNibbles * sizeof(INT16);
+
+			return pFree - Entries;
+		}
+
+		if (pVictim == NULL) return -1;
+
+		AdpcmCacheFree(pVictim);
+	}
+}
+
+void AdpcmCacheExit()
+{
+	for (INT32 i = 0; i < ADPCM_CACHE_ENTRIES; i++) {
+		AdpcmCacheFree(&Entries[i]);
+	}
+
+	nCacheBytes = 0;
+	nCacheClock = 0;
+}
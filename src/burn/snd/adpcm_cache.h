@@ -0,0 +1,34 @@
+// Pre-decoded ADPCM cache, shared by the MSM6295 and YM2608/YM2610 ADPCM-A cores
+//
+// A sample region is decoded once, on the first key-on, into the decoder's
+// output and step index for every nibble.  Entries are keyed on the host
+// address of the sample data, so bank switches don't invalidate them; the
+// cores detach playing channels themselves when their bank is remapped.
+
+#ifndef ADPCM_CACHE_H
+#define ADPCM_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ADPCM_CACHE_MSM6295		0
+#define ADPCM_CACHE_YM2610		1
+
+#define ADPCM_CACHE_ENTRIES		1024
+
+extern UINT32 nAdpcmCacheSerial[ADPCM_CACHE_ENTRIES];
+
+// a slot is reused (and its serial bumped) when the entry is evicted
+#define AdpcmCacheValid(slot, serial)	((slot) >= 0 && nAdpcmCacheSerial[(slot)] == (serial))
+
+INT32 AdpcmCacheEnabled();
+INT32 AdpcmCacheFind(INT32 nType, const UINT8 *pRom, UINT32 nNibbles, INT16 **pPCM, UINT8 **pStep);
+INT32 AdpcmCacheAlloc(INT32 nType, const UINT8 *pRom, UINT32 nNibbles, INT16 **pPCM, UINT8 **pStep);
+void AdpcmCacheExit();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -113,11 +113,13 @@
 #include "deftypes.h"		/* use RAINE */
 #include "support.h"		/* use RAINE */
 #endif
+#include "burn_profile.h"
 
 #define AY8910_CORE
 #include "ay8910.h"
 #undef AY8910_CORE
 #include "fm.h"
+#include "adpcm_cache.h"
 
 
 #ifndef PI
@@ -1692,6 +1694,13 @@ static int init_tables(void)
 	signed int i,x;
 	signed int n;
 	double o,m;
+	static int tables_built = 0;
+
+	/* the tables only depend on constants, they are built for the first chip and kept */
+	if (tables_built) return 1;
+	tables_built = 1;
+
+	BurnProfileBegin("sound tables");
 
 	for (x=0; x<TL_RES_LEN; x++)
 	{
@@ -1799,6 +1808,8 @@ static int init_tables(void)
 	sample[0]=fopen("sampsum.pcm","wb");
 #endif
 
+	BurnProfileEnd();
+
 	return 1;
 
 }
@@ -2588,6 +2599,12 @@ typedef struct
 	INT8		vol_mul;		/* volume in "0.75dB" steps	*/
 	UINT8		vol_shift;		/* volume in "-6dB" steps	*/
 	INT32		*pan;			/* &out_adpcm[OPN_xxxx] 	*/
+	INT32		cache_slot;		/* pre-decoded sample, -1 = none	*/
+	UINT32		cache_serial;
+	UINT32		cache_addr;		/* nibble address of cache_acc[0]	*/
+	UINT32		cache_len;
+	INT16		*cache_acc;
+	UINT8		*cache_step;
 } ADPCM_CH;
 
 /* here's the virtual YM2610 */
@@ -2673,6 +2690,38 @@ INLINE void ADPCMA_calc_chan( YM2610 *F2610, ADPCM_CH *ch )
 	{
 		step = ch->now_step >> ADPCM_SHIFT;
 		ch->now_step &= (1<<ADPCM_SHIFT)-1;
+
+		if ( ch->cache_slot >= 0 )
+		{
+			if ( AdpcmCacheValid(ch->cache_slot, ch->cache_serial) )
+			{
+				/* pre-decoded: jump straight to the last nibble of this step */
+				UINT32 idx  = ch->now_addr - ch->cache_addr;
+				UINT32 left = ch->cache_len - idx;
+				UINT32 n    = (step < left) ? step : left;
+
+				if ( n )
+				{
+					ch->now_addr  += n;
+					ch->now_data   = *(pcmbufA+((ch->now_addr-1)>>1));
+					ch->adpcm_acc  = ch->cache_acc[idx+n-1];
+					ch->adpcm_step = ch->cache_step[idx+n-1] << 4;
+				}
+
+				if ( step > left )
+				{
+					ch->flag = 0;
+					F2610->adpcm_arrivedEndAddress |= ch->flagMask;
+					return;
+				}
+
+				ch->adpcm_out = ((ch->adpcm_acc * ch->vol_mul) >> ch->vol_shift) & ~3;
+				*(ch->pan) += ch->adpcm_out;
+				return;
+			}
+			ch->cache_slot = -1;
+		}
+
 		do{
 			/* end check */
 			/* 11-06-2001 JB: corrected comparison. Was > instead of == */
@@ -2722,6 +2771,55 @@ INLINE void ADPCMA_calc_chan( YM2610 *F2610, ADPCM_CH *ch )
 	*(ch->pan) += ch->adpcm_out;
 }
 
+/* ADPCM type A : decode the whole start-end region once (optional) */
+static void FM_ADPCMACacheAttach(YM2610 *F2610, ADPCM_CH *ch)
+{
+	UINT32 nibbles = ((ch->end<<1) - (ch->start<<1)) & ((1<<21)-1);
+	const UINT8 *rom = F2610->pcmbuf + ch->start;
+	INT16 *acc_buf;
+	UINT8 *step_buf;
+	INT32 slot, acc, stp;
+	UINT32 i;
+
+	ch->cache_slot = -1;
+
+	if ( !AdpcmCacheEnabled() || nibbles == 0 ) return;
+	if ( ch->start + ((nibbles+1)>>1) > F2610->pcm_size ) return;	/* wraps the bank or runs off the rom */
+
+	slot = AdpcmCacheFind(ADPCM_CACHE_YM2610, rom, nibbles, &acc_buf, &step_buf);
+	if ( slot < 0 )
+	{
+		slot = AdpcmCacheAlloc(ADPCM_CACHE_YM2610, rom, nibbles, &acc_buf, &step_buf);
+		if ( slot < 0 ) return;
+
+		acc = 0;
+		stp = 0;
+		for ( i = 0; i < nibbles; i++ )
+		{
+			UINT8 data = (i & 1) ? (rom[i>>1] & 0x0f) : ((rom[i>>1] >> 4) & 0x0f);
+
+			acc += jedi_table[stp + data];
+			if (acc & ~0x7ff)
+				acc |= ~0xfff;
+			else
+				acc &= 0xfff;
+
+			stp += step_inc[data & 7];
+			Limit( stp, 48*16, 0*16 );
+
+			acc_buf[i]  = acc;
+			step_buf[i] = stp >> 4;
+		}
+	}
+
+	ch->cache_slot   = slot;
+	ch->cache_serial = nAdpcmCacheSerial[slot];
+	ch->cache_addr   = ch->start<<1;
+	ch->cache_len    = nibbles;
+	ch->cache_acc    = acc_buf;
+	ch->cache_step   = step_buf;
+}
+
 /* ADPCM type A Write */
 static void FM_ADPCMAWrite(YM2610 *F2610,int r,int v)
 {
@@ -2746,6 +2844,7 @@ static void FM_ADPCMAWrite(YM2610 *F2610,int r,int v)
 					adpcm[c].adpcm_step= 0;
 					adpcm[c].adpcm_out = 0;
 					adpcm[c].flag      = 1;
+					adpcm[c].cache_slot= -1;
 
 					if(F2610->pcmbuf==NULL){					/* Check ROM Mapped */
 						logerror("YM2608-YM2610: ADPCM-A rom not mapped\n");
@@ -2760,6 +2859,8 @@ static void FM_ADPCMAWrite(YM2610 *F2610,int r,int v)
 							logerror("YM2608-YM2610: ADPCM-A start out of range: $%08x\n",adpcm[c].start);
 							adpcm[c].flag = 0;
 						}
+						if(adpcm[c].flag)
+							FM_ADPCMACacheAttach(F2610, &adpcm[c]);
 					}
 				}
 			}
@@ -3118,6 +3219,8 @@ static void YM2608_postload(void)
 		/* FM channels */
 		/*FM_channel_postload(F2608->CH,6);*/
 		/* rhythm(ADPCMA) */
+		for( r=0 ; r<6 ; r++)
+			F2608->adpcm[r].cache_slot = -1;	/* play on through the decoder */
 		FM_ADPCMAWrite(F2608,1,F2608->REGS[0x111]);
 		for( r=0x08 ; r<0x0c ; r++)
 			FM_ADPCMAWrite(F2608,r,F2608->REGS[r+0x110]);
@@ -3243,6 +3346,8 @@ void YM2608Shutdown()
 	}
 	
 	YM2608_ADPCM_ROM = NULL;
+
+	AdpcmCacheExit();
 }
 
 /* reset one of chips */
@@ -3308,6 +3413,7 @@ void YM2608ResetChip(int num)
 		F2608->adpcm[i].pan       = &out_adpcm[OUTD_CENTER]; /* default center */
 		F2608->adpcm[i].flagMask  = 0;
 		F2608->adpcm[i].flag      = 0;
+		F2608->adpcm[i].cache_slot= -1;
 		F2608->adpcm[i].adpcm_acc = 0;
 		F2608->adpcm[i].adpcm_step= 0;
 		F2608->adpcm[i].adpcm_out = 0;
@@ -3835,6 +3941,7 @@ static void YM2610_postload(void)
 		FM_ADPCMAWrite(F2610,1,F2610->REGS[0x101]);
 		for( r=0 ; r<6 ; r++)
 		{
+			F2610->adpcm[r].cache_slot = -1;	/* play on through the decoder */
 			FM_ADPCMAWrite(F2610,r+0x08,F2610->REGS[r+0x108]);
 			FM_ADPCMAWrite(F2610,r+0x10,F2610->REGS[r+0x110]);
 			FM_ADPCMAWrite(F2610,r+0x18,F2610->REGS[r+0x118]);
@@ -3952,6 +4059,11 @@ void YM2610SetRom(int num, void *pcmroma,int pcmsizea,void *pcmromb,int pcmsizeb
 	/* ADPCM */
 	F2610->pcmbuf   = (UINT8 *)pcmroma;
 	F2610->pcm_size = pcmsizea;
+	{
+		int i;
+		for( i=0 ; i<6 ; i++)
+			F2610->adpcm[i].cache_slot = -1;
+	}
 	/* DELTA-T */
 	F2610->deltaT.memory = (UINT8 *)pcmromb;
 	F2610->deltaT.memory_size = pcmsizeb;
@@ -3972,6 +4084,8 @@ void YM2610Shutdown()
 		free(FM2610);
 		FM2610 = NULL;
 	}
+
+	AdpcmCacheExit();
 }
 
 /* reset one of chip */
@@ -4021,6 +4135,7 @@ void YM2610ResetChip(int num)
 		F2610->adpcm[i].pan       = &out_adpcm[OUTD_CENTER]; /* default center */
 		F2610->adpcm[i].flagMask  = 1<<i;
 		F2610->adpcm[i].flag      = 0;
+		F2610->adpcm[i].cache_slot= -1;
 		F2610->adpcm[i].adpcm_acc = 0;
 		F2610->adpcm[i].adpcm_step= 0;
 		F2610->adpcm[i].adpcm_out = 0;
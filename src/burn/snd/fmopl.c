@@ -1154,6 +1154,11 @@ static int init_tables(void)
 	signed int i,x;
 	signed int n;
 	double o,m;
+	static int tables_built = 0;
+
+	/* the tables only depend on constants, they are built for the first chip and kept */
+	if (tables_built) return 1;
+	tables_built = 1;
 
 
 	for (x=0; x<TL_RES_LEN; x++)
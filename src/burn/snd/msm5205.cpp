@@ -49,10 +49,10 @@ struct _MSM5205_state
 	INT32 select;       	  /* prescaler / bit width selector        */
 	INT32 bAdd;
 	INT32 streampos;
-
-	INT32 diff_lookup[49*16];
 };
 
+static INT32 diff_lookup[49*16];	/* the same for every chip, built by the first ComputeTables() */
+
 static INT16 *stream[MAX_MSM5205];
 static struct _MSM5205_state chips[MAX_MSM5205];
 static struct _MSM5205_state *voice;
@@ -77,6 +77,10 @@ static void ComputeTables(INT32 chip)
 	};
 
 	INT32 step, nib;
+	static bool bDone = false;
+
+	if (bDone) return;
+	bDone = true;
 
 	/* loop over all possible steps */
 	for (step = 0; step <= 48; step++)
@@ -87,7 +91,7 @@ static void ComputeTables(INT32 chip)
 		/* loop over all nibbles and compute the difference */
 		for (nib = 0; nib < 16; nib++)
 		{
-			voice->diff_lookup[step*16 + nib] = nbl2bit[nib][0] *
+			diff_lookup[step*16 + nib] = nbl2bit[nib][0] *
 				(stepval   * nbl2bit[nib][1] +
 				 stepval/2 * nbl2bit[nib][2] +
 				 stepval/4 * nbl2bit[nib][3] +
@@ -167,7 +171,7 @@ static void MSM5205_vclk_callback(INT32 chip)
 	else
 	{
 		INT32 val = voice->data;
-		new_signal = voice->signal + voice->diff_lookup[voice->step * 16 + (val & 15)];
+		new_signal = voice->signal + diff_lookup[voice->step * 16 + (val & 15)];
 		if (new_signal > 2047) new_signal = 2047;
 		else if (new_signal < -2048) new_signal = -2048;
 		voice->step += index_shift[val & 7];
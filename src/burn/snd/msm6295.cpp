@@ -4,6 +4,7 @@
 #include <math.h>
 #include "burnint.h"
 #include "msm6295.h"
+#include "adpcm_cache.h"
 #include <stddef.h>
 
 UINT8* MSM6295ROM;
@@ -45,6 +46,21 @@ static struct MSM6295Struct MSM6295[MAX_MSM6295];
 static UINT8 *pBankPointer[MAX_MSM6295][0x40000/0x100];
 INT32 nLastMSM6295Chip;
 
+// Pre-decoded sample a channel is playing from (nBurnADPCMCacheSize), not scanned
+struct MSM6295CacheInfo {
+	INT32 nSlot;
+	UINT32 nSerial;
+	INT32 nStart;			// nibble address the sample started at
+	INT32 nEnd;
+	const UINT8 *pRom;
+	INT16 *pPCM;
+	UINT8 *pStep;
+};
+
+static struct MSM6295CacheInfo MSM6295Cache[MAX_MSM6295][4];
+
+static void MSM6295CacheDetach(INT32 nChip, INT32 nChannel);
+
 void MSM6295SetBank(INT32 nChip, UINT8 *pRomData, INT32 nStart, INT32 nEnd)
 {
 #if defined FBNEO_DEBUG
@@ -59,10 +75,25 @@ void MSM6295SetBank(INT32 nChip, UINT8 *pRomData, INT32 nStart, INT32 nEnd)
 //	if (nEnd >= nStart) return;
 //	if (nEnd >= 0x40000) nEnd = 0x40000;
 
+	bool bChanged = false;
+
 	for (INT32 i = 0; i < ((nEnd - nStart) >> 8) + 1; i++)
 	{
+		if (pBankPointer[nChip][(nStart >> 8) + i] != pRomData + (i << 8)) bChanged = true;
+
 		pBankPointer[nChip][(nStart >> 8) + i] = pRomData + (i << 8);
 	}
+
+	if (bChanged) {
+		// channels playing a cached sample from the remapped range go back to reading the rom
+		for (INT32 nChannel = 0; nChannel < 4; nChannel++) {
+			struct MSM6295CacheInfo *pCache = &MSM6295Cache[nChip][nChannel];
+
+			if (pCache->nSlot >= 0 && (pCache->nStart >> 1) <= nEnd && (pCache->nEnd >> 1) >= nStart) {
+				MSM6295CacheDetach(nChip, nChannel);
+			}
+		}
+	}
 }
 
 #if defined FBNEO_DEBUG
@@ -94,6 +125,118 @@ static INT32 nPreviousSample[MAX_MSM6295], nCurrentSample[MAX_MSM6295];
 
 static bool bAdd;
 
+// Stop using the cache for a channel, the decoder state in ChannelInfo is kept
+// current while cached so it simply carries on from the rom
+static void MSM6295CacheDetach(INT32 nChip, INT32 nChannel)
+{
+	MSM6295Cache[nChip][nChannel].nSlot = -1;
+}
+
+static void MSM6295CacheAttach(INT32 nChip, INT32 nChannel, INT32 nSampleStart, INT32 nSampleCount)
+{
+	struct MSM6295CacheInfo *pCache = &MSM6295Cache[nChip][nChannel];
+
+	pCache->nSlot = -1;
+
+	if (!AdpcmCacheEnabled() || nSampleCount <= 0) return;
+
+	// the sample has to be contiguous in memory
+	INT32 nFirst = nSampleStart >> 1;
+	INT32 nLast = (nSampleStart + nSampleCount - 1) >> 1;
+
+	if (nLast > 0x3ffff || pBankPointer[nChip][nFirst >> 8] == NULL) return;
+
+	for (INT32 nPage = (nFirst >> 8) + 1; nPage <= (nLast >> 8); nPage++) {
+		if (pBankPointer[nChip][nPage] != pBankPointer[nChip][nPage - 1] + 0x100) return;
+	}
+
+	const UINT8 *pRom = pBankPointer[nChip][nFirst >> 8] + (nFirst & 0xff);
+
+	INT32 nSlot = AdpcmCacheFind(ADPCM_CACHE_MSM6295, pRom, nSampleCount, &pCache->pPCM, &pCache->pStep);
+
+	if (nSlot < 0) {
+		nSlot = AdpcmCacheAlloc(ADPCM_CACHE_MSM6295, pRom, nSampleCount, &pCache->pPCM, &pCache->pStep);
+		if (nSlot < 0) return;
+
+		// same decoder as MSM6295DecodeNibble, starting from a fresh channel
+		INT32 nSample = -1, nStep = 0;
+
+		for (INT32 i = 0; i < nSampleCount; i++) {
+			INT32 nDelta = (i & 1) ? (pRom[i >> 1] & 0x0F) : (pRom[i >> 1] >> 4);
+
+			nSample += MSM6295DeltaTable[(nStep << 4) + nDelta];
+			if (nSample > 2047) nSample = 2047;
+			if (nSample < -2048) nSample = -2048;
+
+			nStep += MSM6295StepShift[nDelta & 7];
+			if (nStep > 48) nStep = 48;
+			if (nStep < 0) nStep = 0;
+
+			pCache->pPCM[i] = nSample;
+			pCache->pStep[i] = nStep;
+		}
+	}
+
+	pCache->nSlot = nSlot;
+	pCache->nSerial = nAdpcmCacheSerial[nSlot];
+	pCache->nStart = nSampleStart;
+	pCache->nEnd = nSampleStart + nSampleCount - 1;
+	pCache->pRom = pRom;
+}
+
+// Decode the next nibble of a channel, returns the new 12-bit sample
+static inline INT32 MSM6295DecodeNibble(INT32 nChip, INT32 nChannel, MSM6295ChannelInfo* pChannelInfo)
+{
+	INT32 nDelta, nSample;
+	struct MSM6295CacheInfo *pCache = &MSM6295Cache[nChip][nChannel];
+
+	if (pCache->nSlot >= 0) {
+		if (AdpcmCacheValid(pCache->nSlot, pCache->nSerial)) {
+			INT32 i = pChannelInfo->nPosition - pCache->nStart;
+
+			if ((i & 1) == 0) pChannelInfo->nDelta = pCache->pRom[i >> 1];
+			pChannelInfo->nSample = pCache->pPCM[i];
+			pChannelInfo->nStep = pCache->pStep[i];
+
+			return pChannelInfo->nSample;
+		}
+
+		// evicted while playing
+		MSM6295CacheDetach(nChip, nChannel);
+	}
+
+	// Get new delta from ROM
+	if (pChannelInfo->nPosition & 1) {
+		nDelta = pChannelInfo->nDelta & 0x0F;
+	} else {
+		pChannelInfo->nDelta = MSM6295ReadData(nChip, (pChannelInfo->nPosition >> 1) & 0x3ffff);
+		nDelta = pChannelInfo->nDelta >> 4;
+	}
+
+	// Compute new sample
+	nSample = pChannelInfo->nSample + MSM6295DeltaTable[(pChannelInfo->nStep << 4) + nDelta];
+	if (nSample > 2047) {
+		nSample = 2047;
+	} else {
+		if (nSample < -2048) {
+			nSample = -2048;
+		}
+	}
+	pChannelInfo->nSample = nSample;
+
+	// Update step value
+	pChannelInfo->nStep = pChannelInfo->nStep + MSM6295StepShift[nDelta & 7];
+	if (pChannelInfo->nStep > 48) {
+		pChannelInfo->nStep = 48;
+	} else {
+		if (pChannelInfo->nStep < 0) {
+			pChannelInfo->nStep = 0;
+		}
+	}
+
+	return nSample;
+}
+
 void MSM6295Reset(INT32 nChip)
 {
 #if defined FBNEO_DEBUG
@@ -113,6 +256,7 @@ void MSM6295Reset(INT32 nChip)
 		MSM6295[nChip].ChannelInfo[nChannel].nPlaying = 0;
 		memset(MSM6295ChannelData[nChip][nChannel], 0, 0x1000 * sizeof(INT32));
 		MSM6295[nChip].ChannelInfo[nChannel].nBufPos = 4;
+		MSM6295Cache[nChip][nChannel].nSlot = -1;
 	}
 
 	// set bank data only if DataPointer has not already been set
@@ -132,7 +276,7 @@ void MSM6295Reset()
 	}
 }
 
-void MSM6295Scan(INT32 , INT32 *)
+void MSM6295Scan(INT32 nAction, INT32 *)
 {
 #if defined FBNEO_DEBUG
 	if (!DebugSnd_MSM6295Initted) bprintf(PRINT_ERROR, _T("MSM6295Scan called without init\n"));
@@ -142,6 +286,13 @@ void MSM6295Scan(INT32 , INT32 *)
 	{
 		ScanVar(&MSM6295[nChip], STRUCT_SIZE_HELPER(struct MSM6295Struct, nSampleInfo), "MSM6295 Chip");
 		SCAN_VAR(nMSM6295Status[nChip]);
+
+		if (nAction & ACB_WRITE) {
+			// the restored channels carry on decoding from the rom
+			for (INT32 nChannel = 0; nChannel < 4; nChannel++) {
+				MSM6295CacheDetach(nChip, nChannel);
+			}
+		}
 	}
 }
 
@@ -150,7 +301,7 @@ static void MSM6295Render_Linear(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf,
 	INT32 nVolume = MSM6295[nChip].nVolume;
 	INT32 nFractionalPosition = MSM6295[nChip].nFractionalPosition;
 
-	INT32 nChannel, nDelta, nSample;
+	INT32 nChannel, nSample;
 	MSM6295ChannelInfo* pChannelInfo;
 
 	while (nSegmentLength--) {
@@ -172,36 +323,10 @@ static void MSM6295Render_Linear(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf,
 							continue;
 						}
 
-						// Get new delta from ROM
-						if (pChannelInfo->nPosition & 1) {
-							nDelta = pChannelInfo->nDelta & 0x0F;
-						} else {
-							pChannelInfo->nDelta = MSM6295ReadData(nChip, (pChannelInfo->nPosition >> 1) & 0x3ffff);
-							nDelta = pChannelInfo->nDelta >> 4;
-						}
-
 						// Compute new sample
-						nSample = pChannelInfo->nSample + MSM6295DeltaTable[(pChannelInfo->nStep << 4) + nDelta];
-						if (nSample > 2047) {
-							nSample = 2047;
-						} else {
-							if (nSample < -2048) {
-								nSample = -2048;
-							}
-						}
-						pChannelInfo->nSample = nSample;
+						nSample = MSM6295DecodeNibble(nChip, nChannel, pChannelInfo);
 						pChannelInfo->nOutput = (nSample * pChannelInfo->nVolume);
 
-						// Update step value
-						pChannelInfo->nStep = pChannelInfo->nStep + MSM6295StepShift[nDelta & 7];
-						if (pChannelInfo->nStep > 48) {
-							pChannelInfo->nStep = 48;
-						} else {
-							if (pChannelInfo->nStep < 0) {
-								pChannelInfo->nStep = 0;
-							}
-						}
-
 						nCurrentSample[nChip] += pChannelInfo->nOutput / 16;
 
 						// Advance sample position
@@ -238,7 +363,7 @@ static void MSM6295Render_Cubic(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf,
 	INT32 nVolume = MSM6295[nChip].nVolume;
 	INT32 nFractionalPosition;
 
-	INT32 nChannel, nDelta, nSample, nOutput;
+	INT32 nChannel, nSample, nOutput;
 	MSM6295ChannelInfo* pChannelInfo;
 
 	while (nSegmentLength--) {
@@ -265,36 +390,10 @@ static void MSM6295Render_Cubic(INT32 nChip, INT32* pLeftBuf, INT32 *pRightBuf,
 						break;
 
 					} else {
-						// Get new delta from ROM
-						if (pChannelInfo->nPosition & 1) {
-							nDelta = pChannelInfo->nDelta & 0x0F;
-						} else {
-							pChannelInfo->nDelta = MSM6295ReadData(nChip, (pChannelInfo->nPosition >> 1) & 0x3ffff);
-							nDelta = pChannelInfo->nDelta >> 4;
-						}
-
 						// Compute new sample
-						nSample = pChannelInfo->nSample + MSM6295DeltaTable[(pChannelInfo->nStep << 4) + nDelta];
-						if (nSample > 2047) {
-							nSample = 2047;
-						} else {
-							if (nSample < -2048) {
-								nSample = -2048;
-							}
-						}
-						pChannelInfo->nSample = nSample;
+						nSample = MSM6295DecodeNibble(nChip, nChannel, pChannelInfo);
 						pChannelInfo->nOutput = nSample * pChannelInfo->nVolume;
 
-						// Update step value
-						pChannelInfo->nStep = pChannelInfo->nStep + MSM6295StepShift[nDelta & 7];
-						if (pChannelInfo->nStep > 48) {
-							pChannelInfo->nStep = 48;
-						} else {
-							if (pChannelInfo->nStep < 0) {
-								pChannelInfo->nStep = 0;
-							}
-						}
-
 						// The interpolator needs a 16-bit sample, pChannelInfo->nOutput is now a 20-bit number
 						MSM6295ChannelData[nChip][nChannel][pChannelInfo->nBufPos++] = pChannelInfo->nOutput / 16;
 
@@ -442,6 +541,8 @@ void MSM6295Write(INT32 nChip, UINT8 nCommand)
 						MSM6295[nChip].ChannelInfo[nChannel].nPlaying = 1;
 						MSM6295[nChip].ChannelInfo[nChannel].nOutput = 0;
 
+						MSM6295CacheAttach(nChip, nChannel, nSampleStart, nSampleCount);
+
 						nMSM6295Status[nChip] |= nCommand;
 
 						if (nInterpolation >= 3) {
@@ -492,9 +593,13 @@ void MSM6295Exit(INT32 nChip)
 
 	for (INT32 nChannel = 0; nChannel < 4; nChannel++) {
 		BurnFree(MSM6295ChannelData[nChip][nChannel]);
+		MSM6295Cache[nChip][nChannel].nSlot = -1;
 	}
 	
-	if (nChip == nLastMSM6295Chip) DebugSnd_MSM6295Initted = 0;
+	if (nChip == nLastMSM6295Chip) {
+		AdpcmCacheExit();
+		DebugSnd_MSM6295Initted = 0;
+	}
 }
 
 void MSM6295Exit()
@@ -518,6 +623,35 @@ void MSM6295SetSamplerate(INT32 nChip, INT32 nSamplerate)
 	}
 }
 
+// Compute sample deltas, the table doesn't depend on the chip so it's only built once
+static void MSM6295ComputeDeltaTable()
+{
+	static bool bDone = false;
+
+	if (bDone) return;
+	bDone = true;
+
+	for (INT32 i = 0; i < 49; i++) {
+		INT32 nStep = (INT32)(pow(1.1, (double)i) * 16.0);
+		for (INT32 n = 0; n < 16; n++) {
+			INT32 nDelta = nStep >> 3;
+			if (n & 1) {
+				nDelta += nStep >> 2;
+			}
+			if (n & 2) {
+				nDelta += nStep >> 1;
+			}
+			if (n & 4) {
+				nDelta += nStep;
+			}
+			if (n & 8) {
+				nDelta = -nDelta;
+			}
+			MSM6295DeltaTable[(i << 4) + n] = nDelta;
+		}
+	}
+}
+
 INT32 MSM6295Init(INT32 nChip, INT32 nSamplerate, bool bAddSignal)
 {
 	DebugSnd_MSM6295Initted = 1;
@@ -560,26 +694,7 @@ INT32 MSM6295Init(INT32 nChip, INT32 nSamplerate, bool bAddSignal)
 		}
 	}
 
-	// Compute sample deltas
-	for (INT32 i = 0; i < 49; i++) {
-		INT32 nStep = (INT32)(pow(1.1, (double)i) * 16.0);
-		for (INT32 n = 0; n < 16; n++) {
-			INT32 nDelta = nStep >> 3;
-			if (n & 1) {
-				nDelta += nStep >> 2;
-			}
-			if (n & 2) {
-				nDelta += nStep >> 1;
-			}
-			if (n & 4) {
-				nDelta += nStep;
-			}
-			if (n & 8) {
-				nDelta = -nDelta;
-			}
-			MSM6295DeltaTable[(i << 4) + n] = nDelta;
-		}
-	}
+	MSM6295ComputeDeltaTable();
 
 	// Compute volume levels
 	for (INT32 i = 0; i < 16; i++) {
@@ -18,6 +18,15 @@ static INT32 bAddToStream = 0;
 static INT32 nTotalSamples = 0;
 INT32 bBurnSampleTrimSampleEnd = 0;
 
+struct wav_info
+{
+	UINT8 *pcm;				// start of the 'data' chunk
+	UINT32 frames;			// source frames
+	UINT32 sample_rate;
+	UINT16 channels;
+	UINT16 bytes;			// bytes per sample
+};
+
 struct sample_format
 {
 	UINT8 *data;
@@ -29,17 +38,39 @@ struct sample_format
 	INT32 playback_rate; // 100 = 100%, 200 = 200%, 
 	double gain[2];
 	INT32 output_dir[2];
+	UINT8 *source;			// streaming: wav file as loaded from the archive
+	struct wav_info wav;	// streaming: source format
 };
 
 static struct sample_format *samples		= NULL; // store samples
 static struct sample_format *sample_ptr		= NULL; // generic pointer for sample
 static INT32 sample_channels[MAX_CHANNEL];			// channel handling
-	
-static void make_raw(UINT8 *src, UINT32 len)
+
+// Streaming mode (bBurnSampleStreaming): the wavs are fetched from the archive
+// at init but not converted, the source pcm is kept as-is and converted to
+// 16-bit stereo at nBurnSoundRate a chunk at a time into a small LRU cache.
+// SAMPLE_NOSTORE samples are streamed like the others.
+#define STREAM_CHUNK_SHIFT	12						// 4096 frames (16kb) per chunk
+#define STREAM_CHUNK_LEN	(1 << STREAM_CHUNK_SHIFT)
+#define STREAM_CACHE_SIZE	32						// 512kb of converted audio
+
+struct stream_chunk
+{
+	INT32 sample;
+	INT32 chunk;
+	UINT32 last_used;
+	INT16 *data;
+};
+
+static INT32 bStreaming = 0;
+static struct stream_chunk *stream_cache = NULL;
+static UINT32 stream_clock = 0;
+
+static INT32 parse_wav(UINT8 *src, UINT32 len, struct wav_info *wav)
 {
 	UINT8 *ptr = src;
 
-	if (ptr[0] != 'R' || ptr[1] != 'I' || ptr[2] != 'F' || ptr[3] != 'F') return;
+	if (ptr[0] != 'R' || ptr[1] != 'I' || ptr[2] != 'F' || ptr[3] != 'F') return 1;
 	                                    ptr += 4; // skip RIFF
 	UINT32 length = get_long();		    ptr += 4; // total length of file
 	if (len < length) length = len - 8;	    	  // first 8 bytes (RIFF + Len)
@@ -66,106 +97,115 @@ static void make_raw(UINT8 *src, UINT32 len)
 
 	if ((len - (ptr - src)) < data_length) data_length = len - (ptr - src);
 
-	UINT32 converted_len = (UINT32)((float)(data_length * (nBurnSoundRate * 1.00000 / sample_rate) / (bytes * channels)));
-	if (converted_len == 0) return; 
+	if (channels == 0 || sample_rate == 0 || (bytes != 1 && bytes != 2)) return 1;
 
-	sample_ptr->data = (UINT8*)BurnMalloc(converted_len * 4);
+	wav->pcm = ptr;
+	wav->frames = data_length / (bytes * channels);
+	wav->sample_rate = sample_rate;
+	wav->channels = channels;
+	wav->bytes = bytes;
 
-	// up/down sample everything and convert to raw 16 bit stereo
-	INT16 *data = (INT16*)sample_ptr->data;
-	INT16 *poin = (INT16*)ptr;
-	UINT8 *poib = ptr;
+	return 0;
+}
 
-	if ((INT32)sample_rate == nBurnSoundRate)
+static inline UINT32 wav_converted_len(struct wav_info *wav)
+{
+	return (UINT32)((float)(wav->frames * (nBurnSoundRate * 1.00000 / wav->sample_rate)));
+}
+
+// one source frame as 16-bit left/right, silence outside of the sample
+static inline void wav_frame(struct wav_info *wav, INT64 offs, INT32 *l, INT32 *r)
+{
+	if (offs < 0 || offs >= wav->frames) {
+		*l = *r = 0;
+		return;
+	}
+
+	const INT32 channels = wav->channels;
+
+	if (wav->bytes == 2)											// signed 16 bit, stereo & mono
+	{
+		INT16 *poin = (INT16*)wav->pcm;
+		*l = (INT32)(BURN_ENDIAN_SWAP_INT16(poin[offs * channels + 0             ]));
+		*r = (INT32)(BURN_ENDIAN_SWAP_INT16(poin[offs * channels + (channels / 2)]));
+	}
+	else															// unsigned 8 bit, stereo & mono
+	{
+		UINT8 *poib = wav->pcm;
+		*l = (INT32)(poib[offs * channels + 0             ] - 128) << 8; *l |= (*l >> 7) & 0xFF;
+		*r = (INT32)(poib[offs * channels + (channels / 2)] - 128) << 8; *r |= (*r >> 7) & 0xFF;
+	}
+}
+
+// up/down sample frames [start, start + count) and convert to raw 16 bit stereo
+static void wav_convert(struct wav_info *wav, INT16 *data, UINT32 start, UINT32 count)
+{
+	if ((INT32)wav->sample_rate == nBurnSoundRate)
 	{
 		// don't try to interpolate, just copy
-		bprintf(0, _T("Sample at native rate already..\n"));
-		for (UINT32 i = 0; i < converted_len; i++)
+		for (UINT32 i = 0; i < count; i++)
 		{
-			if (bytes == 2)											//  signed 16 bit, stereo & mono
-			{
-				data[i * 2 + 0] = BURN_ENDIAN_SWAP_INT16(poin[i * channels + 0             ]);
-				data[i * 2 + 1] = BURN_ENDIAN_SWAP_INT16(poin[i * channels + (channels / 2)]);
-			}
-			else if (bytes == 1)										// unsigned 8 bit, stereo & mono
-			{
-				data[i * 2 + 0] = (poib[i * channels + 0             ] - 128) << 8; data[i * 2 + 0] |= (data[i * 2 + 0] >> 7) & 0xFF;
-				data[i * 2 + 1] = (poib[i * channels + (channels / 2)] - 128) << 8; data[i * 2 + 1] |= (data[i * 2 + 1] >> 7) & 0xFF;
-			}
+			INT32 l, r;
+			wav_frame(wav, start + i, &l, &r);
+			data[i * 2 + 0] = (INT16)l;
+			data[i * 2 + 1] = (INT16)r;
 		}
+		return;
 	}
-	else
-	{
-		// interpolate sample
-		bprintf(0, _T("Converting %dhz [%d bit, %d channels] to %dhz (native).\n"), sample_rate, bytes*8, channels, nBurnSoundRate);
-		INT32 buffer_l[4];
-		INT32 buffer_r[4];
 
-		memset(buffer_l, 0, sizeof(buffer_l));
-		memset(buffer_r, 0, sizeof(buffer_r));
+	INT32 buffer_l[4];
+	INT32 buffer_r[4];
 
-#if 0
-		// this block causes clicks when the sample loops, disable for now
-		if (sample_ptr->flags & SAMPLE_AUTOLOOP)
-		{
-			UINT8* end = sample_ptr->data + data_length / (bytes * channels);
+	memset(buffer_l, 0, sizeof(buffer_l));
+	memset(buffer_r, 0, sizeof(buffer_r));
 
-			if (bytes == 1)
-			{
-				buffer_l[1] = (INT16)((*(end - 3 * channels)) - 0x80) << 8; buffer_l[1] |= (buffer_l[1] >> 7) & 0xFF;
-				buffer_l[2] = (INT16)((*(end - 2 * channels)) - 0x80) << 8; buffer_l[2] |= (buffer_l[2] >> 7) & 0xFF;
-				buffer_l[3] = (INT16)((*(end - 1 * channels)) - 0x80) << 8; buffer_l[3] |= (buffer_l[3] >> 7) & 0xFF;
+	// prime the window with the 4 source frames leading up to the first output
+	INT64 prev_offs = (INT64)((((UINT64)start * wav->sample_rate) << 12) / nBurnSoundRate >> 12) - 4;
 
-				buffer_r[1] = (INT16)((*(end - 3 * channels) + (channels / 2)) - 0x80) << 8; buffer_r[1] |= (buffer_r[1] >> 7) & 0xFF;
-				buffer_r[2] = (INT16)((*(end - 2 * channels) + (channels / 2)) - 0x80) << 8; buffer_r[2] |= (buffer_r[2] >> 7) & 0xFF;
-				buffer_r[3] = (INT16)((*(end - 1 * channels) + (channels / 2)) - 0x80) << 8; buffer_r[3] |= (buffer_r[3] >> 7) & 0xFF;
-			}
-			else
-			{
-				buffer_l[1] = (INT16)(get_shorti(end - 6 * channels));
-				buffer_l[2] = (INT16)(get_shorti(end - 4 * channels));
-				buffer_l[3] = (INT16)(get_shorti(end - 2 * channels));
+	for (UINT64 i = start; i < (UINT64)start + count; i++)
+	{
+		UINT64 pos = (i * wav->sample_rate << 12) / nBurnSoundRate;
+		INT64 curr_offs = pos >> 12;
 
-				buffer_r[1] = (INT16)(get_shorti(end - 6 * channels) + (channels & 2));
-				buffer_r[2] = (INT16)(get_shorti(end - 4 * channels) + (channels & 2));
-				buffer_r[3] = (INT16)(get_shorti(end - 2 * channels) + (channels & 2));
-			}
+		while (prev_offs != curr_offs)
+		{
+			prev_offs += 1;
+			buffer_l[0] = buffer_l[1]; buffer_r[0] = buffer_r[1];
+			buffer_l[1] = buffer_l[2]; buffer_r[1] = buffer_r[2];
+			buffer_l[2] = buffer_l[3]; buffer_r[2] = buffer_r[3];
+
+			wav_frame(wav, prev_offs, &buffer_l[3], &buffer_r[3]);
 		}
-#endif
-		UINT64 prev_offs = ~0;
 
-		for (UINT64 i = 0; i < converted_len; i++)
-		{
-			UINT64 pos = (i * sample_rate << 12) / nBurnSoundRate;
-			UINT64 curr_offs = pos >> 12;
+		data[(i - start) * 2 + 0] = BURN_SND_CLIP(INTERPOLATE4PS_16BIT(pos & 0x0FFF, buffer_l[0], buffer_l[1], buffer_l[2], buffer_l[3]));
+		data[(i - start) * 2 + 1] = BURN_SND_CLIP(INTERPOLATE4PS_16BIT(pos & 0x0FFF, buffer_r[0], buffer_r[1], buffer_r[2], buffer_r[3]));
+	}
+}
 
-			while (prev_offs != curr_offs)
-			{
-				prev_offs += 1;
-				buffer_l[0] = buffer_l[1]; buffer_r[0] = buffer_r[1];
-				buffer_l[1] = buffer_l[2]; buffer_r[1] = buffer_r[2];
-				buffer_l[2] = buffer_l[3]; buffer_r[2] = buffer_r[3];
-
-				if (bytes == 2)										// signed 16 bit, stereo & mono
-				{
-					buffer_l[3] = (INT32)(BURN_ENDIAN_SWAP_INT16(poin[prev_offs * channels + 0             ]));
-					buffer_r[3] = (INT32)(BURN_ENDIAN_SWAP_INT16(poin[prev_offs * channels + (channels / 2)]));
-				}
-				else if (bytes == 1)									// unsigned 8 bit, stereo & mono
-				{
-					buffer_l[3] = (INT32)(poib[prev_offs * channels + 0             ] - 128) << 8; buffer_l[3] |= (buffer_l[3] >> 7) & 0xFF;
-					buffer_r[3] = (INT32)(poib[prev_offs * channels + (channels / 2)] - 128) << 8; buffer_r[3] |= (buffer_r[3] >> 7) & 0xFF;
-				}
-			}
+static void make_raw(UINT8 *src, UINT32 len)
+{
+	struct wav_info wav;
 
-			data[i * 2 + 0] = BURN_SND_CLIP(INTERPOLATE4PS_16BIT(pos & 0x0FFF, buffer_l[0], buffer_l[1], buffer_l[2], buffer_l[3]));
-			data[i * 2 + 1] = BURN_SND_CLIP(INTERPOLATE4PS_16BIT(pos & 0x0FFF, buffer_r[0], buffer_r[1], buffer_r[2], buffer_r[3]));
-		}
+	if (parse_wav(src, len, &wav)) return;
+
+	UINT32 converted_len = wav_converted_len(&wav);
+	if (converted_len == 0) return; 
+
+	sample_ptr->data = (UINT8*)BurnMalloc(converted_len * 4);
+
+	INT16 *data = (INT16*)sample_ptr->data;
+
+	if ((INT32)wav.sample_rate == nBurnSoundRate) {
+		bprintf(0, _T("Sample at native rate already..\n"));
+	} else {
+		bprintf(0, _T("Converting %dhz [%d bit, %d channels] to %dhz (native).\n"), wav.sample_rate, wav.bytes*8, wav.channels, nBurnSoundRate);
 	}
 
+	wav_convert(&wav, data, 0, converted_len);
+
 	{ // sample cleanup
 		if (bBurnSampleTrimSampleEnd) { // trim silence off the end of the sample, bBurnSampleTrimSampleEnd must be set before init!
-			while (data[converted_len * bytes] == 0) converted_len -= bytes;
+			while (data[converted_len * wav.bytes] == 0) converted_len -= wav.bytes;
 		}
 	}
 
@@ -174,6 +214,85 @@ static void make_raw(UINT8 *src, UINT32 len)
 	sample_ptr->position = 0;
 }
 
+INT32 __cdecl ZipLoadOneFile(char* arcName, const char* fileName, void** Dest, INT32* pnWrote);
+char* TCHARToANSI(const TCHAR* pszInString, char* pszOutString, INT32 nOutSize);
+#define _TtoA(a)	TCHARToANSI(a, NULL, 0)
+
+// fetch a streamed sample's wav from the archive (at init, never from the sound
+// thread), only its header is parsed here
+static void stream_open(INT32 sample)
+{
+	struct sample_format *ptr = &samples[sample];
+
+	char path[256*2];
+	char szTempPath[MAX_PATH];
+	char *szSampleNameTmp = NULL;
+	char szSampleName[1024];
+
+	sprintf(szTempPath, _TtoA(SAMPLE_DIRECTORY));
+	sprintf(path, "%s%s", szTempPath, BurnDrvGetTextA(DRV_SAMPLENAME));
+
+	BurnDrvGetSampleName(&szSampleNameTmp, sample, 0);
+	memset(&szSampleName, 0, sizeof(szSampleName));
+	strncpy(&szSampleName[0], szSampleNameTmp, sizeof(szSampleName) - 5); // leave space for ".wav" + null, just incase!
+	strcat(&szSampleName[0], ".wav");
+
+	void *destination = NULL;
+	INT32 length = 0;
+	ZipLoadOneFile((char*)path, (const char*)szSampleName, &destination, &length);
+
+	if (length == 0 || parse_wav((UINT8*)destination, length, &ptr->wav) || ptr->wav.frames == 0) {
+		free(destination); // ZipLoadOneFile uses malloc()
+		ptr->flags = SAMPLE_IGNORE;
+		ptr->playing = 0;
+		return;
+	}
+
+	if (bBurnSampleTrimSampleEnd) { // trim silence off the end of the source
+		INT32 l, r;
+		while (ptr->wav.frames > 1) {
+			wav_frame(&ptr->wav, ptr->wav.frames - 1, &l, &r);
+			if (l || r) break;
+			ptr->wav.frames--;
+		}
+	}
+
+	bprintf(0, _T("Streaming \"%S\": %dhz [%d bit, %d channels].\n"), szSampleName, ptr->wav.sample_rate, ptr->wav.bytes*8, ptr->wav.channels);
+
+	ptr->source = (UINT8*)destination;
+	ptr->length = wav_converted_len(&ptr->wav);
+}
+
+// converted 16-bit stereo frames of one chunk of a streamed sample
+static INT16 *stream_get_chunk(INT32 sample, INT32 chunk)
+{
+	struct stream_chunk *victim = &stream_cache[0];
+
+	for (INT32 i = 0; i < STREAM_CACHE_SIZE; i++) {
+		struct stream_chunk *c = &stream_cache[i];
+
+		if (c->sample == sample && c->chunk == chunk) {
+			c->last_used = ++stream_clock;
+			return c->data;
+		}
+
+		if (c->last_used < victim->last_used) victim = c;
+	}
+
+	struct sample_format *ptr = &samples[sample];
+	UINT32 start = chunk << STREAM_CHUNK_SHIFT;
+	UINT32 count = ptr->length - start;
+	if (count > STREAM_CHUNK_LEN) count = STREAM_CHUNK_LEN;
+
+	wav_convert(&ptr->wav, victim->data, start, count);
+
+	victim->sample = sample;
+	victim->chunk = chunk;
+	victim->last_used = ++stream_clock;
+
+	return victim->data;
+}
+
 void BurnSampleInitOne(INT32); // below...
 
 INT32 BurnSampleGetChannelSample(INT32 channel)
@@ -198,7 +317,7 @@ void BurnSamplePlay(INT32 sample)
 
 	if (sample_ptr->flags & SAMPLE_IGNORE) return;
 
-	if (sample_ptr->flags & SAMPLE_NOSTORE) {
+	if ((sample_ptr->flags & SAMPLE_NOSTORE) && !bStreaming) {
 		BurnSampleInitOne(sample);
 	}
 
@@ -221,7 +340,7 @@ void BurnSampleChannelPlay(INT32 channel, INT32 sample, bool loop)
 
 	if (sample_ptr->flags & SAMPLE_IGNORE) return;
 
-	if (sample_ptr->flags & SAMPLE_NOSTORE) {
+	if ((sample_ptr->flags & SAMPLE_NOSTORE) && !bStreaming) {
 		BurnSampleInitOne(sample);
 	}
 
@@ -399,10 +518,6 @@ void BurnSampleReset()
 	}
 }
 
-INT32 __cdecl ZipLoadOneFile(char* arcName, const char* fileName, void** Dest, INT32* pnWrote);
-char* TCHARToANSI(const TCHAR* pszInString, char* pszOutString, INT32 nOutSize);
-#define _TtoA(a)	TCHARToANSI(a, NULL, 0)
-
 void BurnSampleInit(INT32 bAdd /*add samples to stream?*/)
 {
 	bAddToStream = bAdd;
@@ -463,6 +578,20 @@ void BurnSampleInit(INT32 bAdd /*add samples to stream?*/)
 	samples = (sample_format*)BurnMalloc(sizeof(sample_format) * nTotalSamples);
 	memset (samples, 0, sizeof(sample_format) * nTotalSamples);
 
+	bStreaming = bBurnSampleStreaming ? 1 : 0;
+
+	if (bStreaming) {
+		stream_cache = (struct stream_chunk*)BurnMalloc(sizeof(struct stream_chunk) * STREAM_CACHE_SIZE);
+
+		for (INT32 i = 0; i < STREAM_CACHE_SIZE; i++) {
+			stream_cache[i].sample = -1;
+			stream_cache[i].chunk = -1;
+			stream_cache[i].last_used = 0;
+			stream_cache[i].data = (INT16*)BurnMalloc(STREAM_CHUNK_LEN * 4);
+		}
+		stream_clock = 0;
+	}
+
 	for (INT32 i = 0; i < nTotalSamples; i++) {
 		BurnDrvGetSampleInfo(&si, i);
 		char *szSampleNameTmp = NULL;
@@ -478,6 +607,17 @@ void BurnSampleInit(INT32 bAdd /*add samples to stream?*/)
 
 		if (si.nFlags == 0) break;
 
+		if (bStreaming) { // fetched now, converted as it plays, see stream_open()
+			sample_ptr->flags = si.nFlags;
+			sample_ptr->gain[BURN_SND_SAMPLE_ROUTE_1] = 1.00;
+			sample_ptr->gain[BURN_SND_SAMPLE_ROUTE_2] = 1.00;
+			sample_ptr->output_dir[BURN_SND_SAMPLE_ROUTE_1] = BURN_SND_ROUTE_BOTH;
+			sample_ptr->output_dir[BURN_SND_SAMPLE_ROUTE_2] = BURN_SND_ROUTE_BOTH;
+			sample_ptr->playback_rate = 100;
+			stream_open(i);
+			continue;
+		}
+
 		if (si.nFlags & SAMPLE_NOSTORE) {
 			sample_ptr->flags = si.nFlags;
 			sample_ptr->data = NULL;
@@ -617,13 +757,26 @@ void BurnSampleExit()
 
 	for (INT32 i = 0; i < nTotalSamples; i++) {
 		sample_ptr = &samples[i];
-		if (sample_ptr)
+		if (sample_ptr) {
 			BurnFree (sample_ptr->data);
+			if (sample_ptr->source) {
+				free(sample_ptr->source); // ZipLoadOneFile uses malloc()
+				sample_ptr->source = NULL;
+			}
+		}
 	}
 
 	if (samples)
 		BurnFree (samples);
 
+	if (stream_cache) {
+		for (INT32 i = 0; i < STREAM_CACHE_SIZE; i++) {
+			BurnFree (stream_cache[i].data);
+		}
+		BurnFree (stream_cache);
+	}
+	bStreaming = 0;
+
 	sample_ptr = NULL;
 	nTotalSamples = 0;
 	bAddToStream = 0;
@@ -652,6 +805,8 @@ void BurnSampleRender(INT16 *pDest, UINT32 pLen)
 		sample_ptr = &samples[i];
 		if (sample_ptr->playing == 0) continue;
 
+		if (bStreaming && sample_ptr->source == NULL) continue; // not in the archive
+
 		INT32 playlen = pLen;
 		INT32 length = sample_ptr->length;
 		UINT64 pos = sample_ptr->position;
@@ -659,6 +814,7 @@ void BurnSampleRender(INT16 *pDest, UINT32 pLen)
 
 		INT16 *dst = pDest;
 		INT16 *dat = (INT16*)sample_ptr->data;
+		INT32 dat_chunk = -1;
 		
 		if (sample_ptr->loop == 0) // if not looping, check to make sure sample is in bounds
 		{
@@ -674,6 +830,8 @@ void BurnSampleRender(INT16 *pDest, UINT32 pLen)
 			if (playlen > (length - current_pos)) playlen = length - current_pos;
 		}
 		
+		if (length == 0) continue;
+
 		length *= 2; // (stereo) used to ensure position is within bounds
 				
 		for (INT32 j = 0; j < playlen; j++, dst+=2, pos+=playback_rate) {
@@ -681,6 +839,15 @@ void BurnSampleRender(INT16 *pDest, UINT32 pLen)
 			UINT32 current_pos = (pos / 0x10000);
 			UINT32 position = current_pos * 2; // ~1
 
+			if (bStreaming) { // position within the current converted chunk
+				UINT32 frame = current_pos % sample_ptr->length;
+				if ((INT32)(frame >> STREAM_CHUNK_SHIFT) != dat_chunk) {
+					dat_chunk = frame >> STREAM_CHUNK_SHIFT;
+					dat = stream_get_chunk(i, dat_chunk);
+				}
+				position = (frame & (STREAM_CHUNK_LEN - 1)) * 2;
+			}
+
 			if (sample_ptr->loop == 0) // if not looping, check to make sure sample is in bounds
 			{
 				// if sample position is greater than length, stop playback
@@ -14,6 +14,7 @@
 #include "driver.h"
 #include "state.h"
 #include "ym2151.h"
+#include "burn_profile.h"
 
 #if defined FBNEO_DEBUG
 #ifdef __GNUC__ 
@@ -527,6 +528,13 @@ static void init_tables(void)
 {
 	signed int i,x,n;
 	double o,m;
+	static int tables_built = 0;
+
+	/* the tables only depend on constants, they are built for the first chip and kept */
+	if (tables_built) return;
+	tables_built = 1;
+
+	BurnProfileBegin("sound tables");
 
 	for (x=0; x<TL_RES_LEN; x++)
 	{
@@ -609,6 +617,8 @@ static void init_tables(void)
 	sample[6]=fopen("samp6.pcm","wb");
 	sample[7]=fopen("samp7.pcm","wb");
 #endif
+
+	BurnProfileEnd();
 }
 
 static void init_chip_tables(YM2151 *chip)
@@ -158,6 +158,7 @@
 #include "support.h"		/* use RAINE */
 #endif
 #include "ym2612.h"
+#include "burn_profile.h"
 
 static INT32 in_reset = 0;
 
@@ -1803,6 +1804,8 @@ static void init_tables(void)
   signed int n;
   double o,m;
 
+  BurnProfileBegin("sound tables");
+
   /* build Linear Power Table */
   for (x=0; x<TL_RES_LEN; x++)
   {
@@ -1903,6 +1906,7 @@ static void init_tables(void)
     }
   }
 
+  BurnProfileEnd();
 }
 
 
@@ -1,4 +1,5 @@
 #include "tiles_generic.h"
+#include "burn_thread.h"
 
 #define MAX_TILEMAPS	32	// number of tile maps allowed
 #define MAX_GFXNUM
@@ -27,12 +28,23 @@ struct GenericTilemap {
 	UINT8 *dirty_tiles;			// 1 skip, 0 draw
 	INT32 dirty_tiles_enable;
 	UINT8 *skip_tiles[MAX_GFX];
+	UINT16 *cache_page;			// every tile pre-rendered at its offset (GenericTilemapUseCache), pixel + color, no flipscreen
+	UINT8 *cache_mask;			// 1 draw, 0 skip, for each pixel of cache_page
+	UINT8 *cache_tile_state;	// per tile offset: 0 nothing to draw, 1 all opaque, 2 mixed
+	UINT8 *cache_dirty;			// per tile offset, 1 re-render
+	INT32 cache_dirty_any;
+	INT32 cache_key;			// draw flags the page was rendered with, -1 invalid
+	UINT32 cache_serial;
+	UINT8 threaded;				// GenericTilemapUseThreads, callbacks can be run from several threads
 };
 
 static GenericTilemap maps[MAX_TILEMAPS];
 static GenericTilemap *cur_map;
 GenericTilesGfx GenericGfxData[MAX_TILEMAPS];
 
+// bumped whenever gfx or transparency setup changes, cached pages older than this are redrawn
+static UINT32 nGenericTilemapCacheSerial = 0;
+
 void GenericTilemapInit(INT32 which, INT32 (*pScan)(INT32 col, INT32 row), void (*pTile)(INT32 offs, GenericTilemapCallbackStruct *sTile), UINT32 tile_width, UINT32 tile_height, UINT32 map_width, UINT32 map_height)
 {
 #if defined FBNEO_DEBUG
@@ -132,6 +144,9 @@ void GenericTilemapSetGfx(INT32 num, UINT8 *gfxbase, INT32 depth, INT32 tile_wid
 
 	ptr->color_offset = color_offset;
 	ptr->color_mask = color_mask;
+	ptr->lazy = NULL;
+
+	nGenericTilemapCacheSerial++;
 
 #if 0
 	UINT32 t = gfxlen / (tile_width * tile_height);
@@ -158,6 +173,10 @@ void GenericTilemapExit()
 		if (cur_map->scrollx_table) BurnFree(cur_map->scrollx_table);
 		if (cur_map->transparent[0]) BurnFree(cur_map->transparent[0]);
 		if (cur_map->dirty_tiles) BurnFree(cur_map->dirty_tiles);
+		if (cur_map->cache_page) BurnFree(cur_map->cache_page);
+		if (cur_map->cache_mask) BurnFree(cur_map->cache_mask);
+		if (cur_map->cache_tile_state) BurnFree(cur_map->cache_tile_state);
+		if (cur_map->cache_dirty) BurnFree(cur_map->cache_dirty);
 
 		for (INT32 j = 0; j < MAX_GFX; j++) {
 			if (cur_map->skip_tiles[j]) {
@@ -297,6 +316,8 @@ void GenericTilemapSetTransparent(INT32 which, UINT32 transparent)
 
 	cur_map->transcolor = transparent;	// pass this to generic tile drawing
 	cur_map->flags |= TMAP_TRANSPARENT;
+
+	nGenericTilemapCacheSerial++;
 }
 
 void GenericTilemapBuildSkipTable(INT32 which, INT32 gfxnum, INT32 transparent)
@@ -338,6 +359,8 @@ void GenericTilemapBuildSkipTable(INT32 which, INT32 gfxnum, INT32 transparent)
 	}
 #endif
 
+	GenericGfxLazyDecodeAll(gfx);	// the table needs every tile
+
 	INT32 one_tile = gfx->width * gfx->height;
 
 	if (cur_map->skip_tiles[gfxnum] == NULL) {
@@ -361,6 +384,8 @@ void GenericTilemapBuildSkipTable(INT32 which, INT32 gfxnum, INT32 transparent)
 		
 		gfxptr += one_tile;
 	}
+
+	nGenericTilemapCacheSerial++;
 }
 
 void GenericTilemapSetTransSplit(INT32 which, INT32 category, UINT16 layer0, UINT16 layer1)
@@ -414,6 +439,8 @@ void GenericTilemapSetTransMask(INT32 which, INT32 category, UINT16 transmask)
 	}
 
 	cur_map->flags |= TMAP_TRANSMASK;
+
+	nGenericTilemapCacheSerial++;
 }
 
 void GenericTilemapCategoryConfig(INT32 which, INT32 categories)
@@ -444,6 +471,8 @@ void GenericTilemapCategoryConfig(INT32 which, INT32 categories)
 	}
 
 	cur_map->flags |= TMAP_TRANSMASK;
+
+	nGenericTilemapCacheSerial++;
 }
 
 void GenericTilemapSetCategoryEntry(INT32 which, INT32 category, INT32 entry, INT32 trans)
@@ -477,6 +506,8 @@ void GenericTilemapSetCategoryEntry(INT32 which, INT32 category, INT32 entry, IN
 #endif
 
 	cur_map->transparent[category][entry] = trans;
+
+	nGenericTilemapCacheSerial++;
 }
 
 void GenericTilemapSetScrollX(INT32 which, INT32 scrollx)
@@ -776,6 +807,61 @@ void GenericTilemapUseDirtyTiles(INT32 which)
 	cur_map->dirty_tiles_enable = 1;
 }
 
+void GenericTilemapUseThreads(INT32 which)
+{
+#if defined FBNEO_DEBUG
+	if (which >= MAX_TILEMAPS) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapUseThreads(%d) called with impossible tilemap!\n"), which);
+		return;
+	}
+#endif
+
+	cur_map = &maps[which];
+
+#if defined FBNEO_DEBUG
+	if (cur_map->initialized == 0) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapUseThreads(%d) called without initialized tilemap!\n"), which);
+		return;
+	}
+#endif
+
+	cur_map->threaded = 1;
+}
+
+void GenericTilemapUseCache(INT32 which)
+{
+#if defined FBNEO_DEBUG
+	if (which >= MAX_TILEMAPS) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapUseCache(%d) called with impossible tilemap!\n"), which);
+		return;
+	}
+#endif
+
+	cur_map = &maps[which];
+
+#if defined FBNEO_DEBUG
+	if (cur_map->initialized == 0) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapUseCache(%d) called without initialized tilemap!\n"), which);
+		return;
+	}
+#endif
+
+	INT32 tiles = cur_map->mwidth * cur_map->mheight;
+	INT32 pixels = tiles * cur_map->twidth * cur_map->theight;
+
+	if (cur_map->cache_page == NULL) {
+		cur_map->cache_page = (UINT16*)BurnMalloc(pixels * sizeof(UINT16));
+		cur_map->cache_mask = (UINT8*)BurnMalloc(pixels);
+		cur_map->cache_tile_state = (UINT8*)BurnMalloc(tiles);
+		cur_map->cache_dirty = (UINT8*)BurnMalloc(tiles);
+	}
+
+	memset (cur_map->cache_dirty, 1, tiles); // force all dirty by default
+
+	cur_map->cache_dirty_any = 1;
+	cur_map->cache_key = -1;
+}
+
 void GenericTilemapSetTileDirty(INT32 which, UINT32 offset)
 {
 #if defined FBNEO_DEBUG
@@ -793,13 +879,22 @@ void GenericTilemapSetTileDirty(INT32 which, UINT32 offset)
 		return;
 	}
 
-	if (cur_map->dirty_tiles_enable == 0) {
-		bprintf (PRINT_ERROR, _T("GenericTilemapSetTileDirty(%d, %x) called without calling GenericTilemapUseDirtyTiles first!\n"), which, offset);
+	if (cur_map->dirty_tiles_enable == 0 && cur_map->cache_page == NULL) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapSetTileDirty(%d, %x) called without calling GenericTilemapUseDirtyTiles or GenericTilemapUseCache first!\n"), which, offset);
 		return;
 	}
 #endif
 
-	cur_map->dirty_tiles[offset % (cur_map->mwidth * cur_map->mheight)] = 1;
+	offset %= cur_map->mwidth * cur_map->mheight;
+
+	if (cur_map->dirty_tiles_enable) {
+		cur_map->dirty_tiles[offset] = 1;
+	}
+
+	if (cur_map->cache_page) {
+		cur_map->cache_dirty[offset] = 1;
+		cur_map->cache_dirty_any = 1;
+	}
 }
 
 void GenericTilemapAllTilesDirty(INT32 which)
@@ -819,13 +914,19 @@ void GenericTilemapAllTilesDirty(INT32 which)
 		return;
 	}
 
-	if (cur_map->dirty_tiles_enable == 0) {
-		bprintf (PRINT_ERROR, _T("GenericTilemapAllTilesDirty(%d) called without calling GenericTilemapUseDirtyTiles first!\n"), which);
+	if (cur_map->dirty_tiles_enable == 0 && cur_map->cache_page == NULL) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapAllTilesDirty(%d) called without calling GenericTilemapUseDirtyTiles or GenericTilemapUseCache first!\n"), which);
 		return;
 	}
 #endif
 
-	memset (cur_map->dirty_tiles, 1, cur_map->mwidth * cur_map->mheight);
+	if (cur_map->dirty_tiles_enable) {
+		memset (cur_map->dirty_tiles, 1, cur_map->mwidth * cur_map->mheight);
+	}
+
+	if (cur_map->cache_page) {
+		cur_map->cache_key = -1;	// redraw the whole page
+	}
 }
 
 INT32 GenericTilemapGetTileDirty(INT32 which, UINT32 offset)
@@ -854,348 +955,682 @@ INT32 GenericTilemapGetTileDirty(INT32 which, UINT32 offset)
 	return cur_map->dirty_tiles[offset % (cur_map->mwidth * cur_map->mheight)];
 }
 
-void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 priority_mask)
+// parameters shared by all bands of one GenericTilemapDraw() call
+struct GenericTilemapDrawInfo {
+	GenericTilemap *map;
+	INT32 which;
+	UINT16 *Bitmap;
+	INT32 priority;
+	INT32 category_or;
+	INT32 opaque;
+	INT32 opaque2;
+	INT32 tgroup;
+	INT32 x_offset;
+	INT32 y_offset;
+	INT32 minx, maxx, miny, maxy;	// clip of the whole layer, used for flipping
+	INT32 cache_key;				// draw flags, see GenericTilemapCacheUpdate()
+	INT32 cached;					// tiles come from the page (GenericTilemapUseCache)
+	INT32 banded;					// split across threads, each tile is looked up and drawn by one band only
+	INT32 band_height;
+	void (*pDraw)(GenericTilemapDrawInfo *info, INT32 band_miny, INT32 band_maxy);
+};
+
+#define TMAP_BLIT_OPAQUE	0
+#define TMAP_BLIT_MASK		1
+#define TMAP_BLIT_TRANSMASK	2
+
+// draw one tile, clipped to the layer's x clip and the band's y range.
+// same output as the RenderCustomTile_Prio_* family, but it only touches
+// locals, so bands can run at the same time.
+template <INT32 mode>
+static void GenericTilemapBlit(GenericTilemapDrawInfo *info, GenericTilesGfx *gfx, UINT32 code, UINT32 color, INT32 sx, INT32 sy, INT32 flipx, INT32 flipy, INT32 transcolor, UINT8 *trans_ptr, INT32 band_miny, INT32 band_maxy)
 {
-#if defined FBNEO_DEBUG
-	if (Bitmap == NULL) {
-		bprintf (PRINT_ERROR, _T("GenericTilemapDraw(%d, Bitmap, %d); called without initialized Bitmap!\n"), which, priority);
-		return;
-	}
-#endif
+	INT32 width = info->map->twidth;
+	INT32 height = info->map->theight;
+
+	INT32 x0 = (sx < info->minx) ? (info->minx - sx) : 0;
+	INT32 x1 = (sx + width > info->maxx) ? (info->maxx - sx) : width;
+	INT32 y0 = (sy < band_miny) ? (band_miny - sy) : 0;
+	INT32 y1 = (sy + height > band_maxy) ? (band_maxy - sy) : height;
+	if (x0 >= x1 || y0 >= y1) return;
+
+	UINT32 nPalette = (color << gfx->depth) + gfx->color_offset;
+	UINT8 *tile = gfx->gfxbase + (code * width * height);
+	INT32 xstep = flipx ? -1 : 1;
+	INT32 xbase = flipx ? (width - 1) : 0;
+	UINT8 primask = GenericTilesPRIMASK;
+	UINT8 priority = info->priority;
+
+	for (INT32 y = y0; y < y1; y++)
+	{
+		UINT8 *src = tile + (flipy ? (height - 1 - y) : y) * width + xbase;
+		UINT16 *dst = info->Bitmap + (sy + y) * nScreenWidth + sx;
+		UINT8 *pri = pPrioDraw + (sy + y) * nScreenWidth + sx;
 
-	cur_map = &maps[which];
+		for (INT32 x = x0; x < x1; x++)
+		{
+			UINT8 pxl = src[x * xstep];
 
-#if defined FBNEO_DEBUG
-	if (cur_map->initialized == 0) {
-		bprintf (PRINT_ERROR, _T("GenericTilemapDraw(%d, Bitmap, %d); called without initialized tilemap!\n"), which, priority);
-		return;
+			if (mode == TMAP_BLIT_MASK && pxl == transcolor) continue;
+			if (mode == TMAP_BLIT_TRANSMASK && trans_ptr[pxl]) continue;
+
+			dst[x] = nPalette + pxl;
+			pri[x] = priority | (pri[x] & primask);
+		}
 	}
-#endif
+}
 
-	if (cur_map->enable == 0) { // layer disabled!
-		return;
+static void GenericTilemapDrawTile(GenericTilemapDrawInfo *info, GenericTilemapCallbackStruct *sTileData, GenericTilesGfx *gfx, UINT32 category, INT32 sx, INT32 sy, INT32 flipx, INT32 flipy, INT32 band_miny, INT32 band_maxy)
+{
+	GenericTilemap *map = info->map;
+	INT32 transparent = (sTileData->flags & TILE_OPAQUE) == 0 && info->opaque == 0 && info->opaque2 == 0;
+
+	if ((map->flags & TMAP_TRANSPARENT) && transparent) {
+		GenericTilemapBlit<TMAP_BLIT_MASK>(info, gfx, sTileData->code, sTileData->color, sx, sy, flipx, flipy, map->transcolor, NULL, band_miny, band_maxy);
+	} else if ((map->flags & TMAP_TRANSMASK) && transparent) {
+		GenericTilemapBlit<TMAP_BLIT_TRANSMASK>(info, gfx, sTileData->code, sTileData->color, sx, sy, flipx, flipy, 0, map->transparent[category], band_miny, band_maxy);
+	} else {
+		GenericTilemapBlit<TMAP_BLIT_OPAQUE>(info, gfx, sTileData->code, sTileData->color, sx, sy, flipx, flipy, 0, NULL, band_miny, band_maxy);
 	}
+}
 
-	INT32 minx, maxx, miny, maxy;
-	GenericTilesGetClip(&minx, &maxx, &miny, &maxy);
+// tile lookup without the dirty tiles check, returns NULL if the tile is not drawn
+static GenericTilesGfx *GenericTilemapLookupTile(GenericTilemapDrawInfo *info, INT32 offset, GenericTilemapCallbackStruct *sTileData, UINT32 *category)
+{
+	GenericTilemap *map = info->map;
 
-	// check clipping and fix clipping sizes if out of bounds
-	if (minx < 0 || maxx > nScreenWidth || miny < 0 || maxy > nScreenHeight) {
-		bprintf (PRINT_ERROR, _T("GenericTilemapDraw(%d, Bitmap, %d) called with improper clipping values (%d, %d, %d, %d)!"), which, priority, minx, maxx, miny, maxy);
-		bprintf (PRINT_ERROR, _T("pPrioDraw is %d pixels wide and %d pixels high!\n"), nScreenWidth, nScreenHeight);
+	sTileData->category = 0;
 
-		if (minx < 0) minx = 0;
-		if (maxx >= nScreenWidth) maxx = nScreenWidth;
-		if (miny < 0) miny = 0;
-		if (maxy >= nScreenHeight) maxy = nScreenHeight;
+	map->pTile(offset, sTileData);
+
+	*category = sTileData->category | info->category_or;
+
+	if (*category && (map->flags & TMAP_TRANSMASK)) {
+		if (map->transparent[*category] == NULL) {
+			*category = 0;
+		}
 	}
 
-	GenericTilesPRIMASK = priority_mask;
+	GenericTilesGfx *gfx = &GenericGfxData[sTileData->gfx];
 
-	INT32 category_or = (priority & TMAP_DRAWLAYER1) ? 2 : 0;
-	INT32 opaque = priority & TMAP_FORCEOPAQUE;
-	INT32 opaque2 = priority & TMAP_DRAWOPAQUE;
-	INT32 tgroup = (priority >> 8) & 0xff;
-	priority &= 0xff;
+#if defined FBNEO_DEBUG
+	if (gfx->gfxbase == NULL) {
+		bprintf (PRINT_ERROR,_T("GenericTilemapDraw(%d) gfx[%d] not initialized!\n"), info->which, sTileData->gfx);
+		return NULL;
+	}
 
-	INT32 x_offset = cur_map->xoffset[(cur_map->flags & TMAP_FLIPX) ? 1 : 0];
-	INT32 y_offset = cur_map->yoffset[(cur_map->flags & TMAP_FLIPY) ? 1 : 0];
+	if (((UINT32)gfx->width != map->twidth) || ((UINT32)gfx->height != map->theight))
+	{
+		bprintf (PRINT_ERROR,_T("GenericTilemapDraw(%d) gfx[%d] tile dimensions (%dx%d do not match tilemap tile dimensions (%dx%d)!\n"), info->which, sTileData->gfx, gfx->width, gfx->height, map->twidth, map->theight);
+		return NULL;
+	}
+#endif
 
-	struct GenericTilemapCallbackStruct sTileData;
+	sTileData->code %= gfx->code_mask;
+	GenericGfxCheckTile(gfx, sTileData->code);
 
-	// column (less than tile size) and line scroll
-	if ((cur_map->scrolly_table != NULL) && (cur_map->scroll_cols > cur_map->mwidth))
+	if (info->opaque == 0)
 	{
-		INT32 bitmap_width = maxx - minx;
-		INT32 scrymod = (cur_map->mheight * cur_map->theight);
-		INT32 scrxmod = (cur_map->mwidth * cur_map->twidth);
+		if (map->skip_tiles[sTileData->gfx] && (map->flags & TMAP_TRANSPARENT)) {	// skip this tile
+			if (map->skip_tiles[sTileData->gfx][sTileData->code]) {
+				return NULL;
+			}
+		}
 
-		for (INT32 y = miny; y < maxy; y++)
-		{
-			for (INT32 x = 0; x < bitmap_width; x++)
-			{
-				INT32 sx;
-				if (cur_map->scrollx_table != NULL)
-					sx = (x + cur_map->scrollx_table[(y * cur_map->scroll_rows) / scrymod] - x_offset) % scrxmod;
-				else
-					sx = (x + cur_map->scrolly - x_offset) % scrxmod;
+		if (sTileData->flags & TILE_SKIP) return NULL; // skip this tile
 
-				INT32 sy = (y + cur_map->scrolly_table[(sx * cur_map->scroll_cols) / scrxmod] - y_offset) % scrymod;
+		if (sTileData->flags & TILE_GROUP_ENABLE) {
+			INT32 group = (sTileData->flags >> 16) & 0xff;
 
-				INT32 row = sy / cur_map->theight;
-				INT32 col = sx / cur_map->twidth;
+			if (group != info->tgroup) {
+				return NULL;
+			}
+		}
+	}
 
-				INT32 by = sy;
-				if (cur_map->flags & TMAP_FLIPY) {
-					by = (bitmap_width - cur_map->theight) - by;
-				}
+	return gfx;
+}
 
-				INT32 bx = sx;
-				if (cur_map->flags & TMAP_FLIPX) {
-					bx = (bitmap_width - cur_map->twidth) - bx;
-				}
+// common part of the tile lookup, returns NULL if the tile is not drawn
+static GenericTilesGfx *GenericTilemapGetTile(GenericTilemapDrawInfo *info, INT32 offset, GenericTilemapCallbackStruct *sTileData, UINT32 *category)
+{
+	GenericTilemap *map = info->map;
 
-				INT32 offset = cur_map->pScan(col,row);
+	if (map->dirty_tiles_enable) {
+		if (map->dirty_tiles[offset] == 0) return NULL;
+		map->dirty_tiles[offset] = 0;
+	}
 
-				if (cur_map->dirty_tiles_enable) {
-					if (cur_map->dirty_tiles[offset] == 0) continue;
-					cur_map->dirty_tiles[offset] = 0;
-				}
+	return GenericTilemapLookupTile(info, offset, sTileData, category);
+}
 
-				sTileData.category = 0;
+// vertically visible and drawn by this band: a tile straddling a band edge belongs to the
+// band holding its top visible line and is drawn whole (clipped to miny / maxy) from there,
+// so it is only looked up once. unbanded, the band is miny - maxy and this is the plain clip.
+static inline INT32 GenericTilemapBandOwns(GenericTilemapDrawInfo *info, INT32 sy, INT32 band_miny, INT32 band_maxy)
+{
+	INT32 top = (sy < info->miny) ? info->miny : sy;
 
-				cur_map->pTile(offset, &sTileData);
+	return (sy + (INT32)info->map->theight > info->miny) && (top >= band_miny) && (top < band_maxy);
+}
 
-				UINT32 category = sTileData.category | category_or;
-				
-				if (category && (cur_map->flags & TMAP_TRANSMASK)) {
-					if (cur_map->transparent[category] == NULL) {
-						category = 0;
-					}
-				}
+// cached tiles (GenericTilemapUseCache)
+//
+// Every tile of the map is kept rendered in the page at its tile offset, pixel + color like the
+// bitmap and with the tile's own flips, along with a mask of the pixels that would be drawn.
+// The scroll and row / column scroll walks still place each tile exactly as before, they just
+// copy its rows from the page (memcpy where the whole tile is drawn, masked otherwise) instead
+// of calling the tile callback and reading the gfx, so the output is the same at every edge.
 
-				GenericTilesGfx *gfx = &GenericGfxData[sTileData.gfx];
+// render one tile into the page
+static void GenericTilemapCacheTile(GenericTilemapDrawInfo *info, INT32 offset)
+{
+	GenericTilemap *map = info->map;
+	struct GenericTilemapCallbackStruct sTileData;
+	UINT32 category;
 
-#if defined FBNEO_DEBUG
-				if (gfx->gfxbase == NULL) {
-					bprintf (PRINT_ERROR,_T("GenericTilemapDraw(%d) gfx[%d] not initialized!\n"), which, sTileData.gfx);
-					continue;
-				}
+	INT32 width = map->twidth;
+	INT32 height = map->theight;
 
-				if (((UINT32)gfx->width != cur_map->twidth) || ((UINT32)gfx->height != cur_map->theight))
-				{
-					bprintf (PRINT_ERROR,_T("GenericTilemapDraw(%d) gfx[%d] tile dimensions (%dx%d do not match tilemap tile dimensions (%dx%d)!\n"), which, sTileData.gfx, gfx->width, gfx->height, cur_map->twidth, cur_map->theight);
-					continue;
-				}
-#endif
+	UINT8 *state = &map->cache_tile_state[offset];
 
-				sTileData.code %= gfx->code_mask;
+	GenericTilesGfx *gfx = GenericTilemapLookupTile(info, offset, &sTileData, &category);
+	if (gfx == NULL) {
+		*state = 0;
+		return;
+	}
 
-				if (opaque == 0)
-				{
-					if (cur_map->skip_tiles[sTileData.gfx] && (cur_map->flags & TMAP_TRANSPARENT))	// skip this tile
-						if (cur_map->skip_tiles[sTileData.gfx][sTileData.code])
-							continue; 
+	// same choice as GenericTilemapDrawTile()
+	INT32 transparent = (sTileData.flags & TILE_OPAQUE) == 0 && info->opaque == 0 && info->opaque2 == 0;
+	INT32 mode = TMAP_BLIT_OPAQUE;
+	if ((map->flags & TMAP_TRANSPARENT) && transparent) {
+		mode = TMAP_BLIT_MASK;
+	} else if ((map->flags & TMAP_TRANSMASK) && transparent) {
+		mode = TMAP_BLIT_TRANSMASK;
+	}
 
-					if (sTileData.flags & TILE_SKIP) continue; // skip this tile
+	UINT8 *trans_ptr = map->transparent[category];
+	UINT32 nPalette = ((sTileData.color & gfx->color_mask) << gfx->depth) + gfx->color_offset;
+	UINT8 *tile = gfx->gfxbase + (sTileData.code * width * height);
+	INT32 flipx = sTileData.flags & TILE_FLIPX;
+	INT32 flipy = sTileData.flags & TILE_FLIPY;
 
-					if (sTileData.flags & TILE_GROUP_ENABLE) {
-						INT32 group = (sTileData.flags >> 16) & 0xff;
+	UINT16 *dst = map->cache_page + offset * width * height;
+	UINT8 *msk = map->cache_mask + offset * width * height;
+	INT32 drawn = 0;
 
-						if (group != tgroup) {
-							continue;
-						}
-					}
-				}
+	for (INT32 y = 0; y < height; y++, dst += width, msk += width)
+	{
+		UINT8 *src = tile + (flipy ? (height - 1 - y) : y) * width;
 
-				sTileData.color = ((sTileData.color & gfx->color_mask) << gfx->depth) + gfx->color_offset;
+		for (INT32 x = 0; x < width; x++)
+		{
+			UINT8 pxl = src[flipx ? (width - 1 - x) : x];
+			UINT8 draw = 1;
 
-				INT32 flipx = sTileData.flags & TILE_FLIPX; 
-				INT32 flipy = sTileData.flags & TILE_FLIPY;
-				if (cur_map->flags & TMAP_FLIPY) flipy ^= TILE_FLIPY;
-				if (cur_map->flags & TMAP_FLIPX) flipy ^= TILE_FLIPX;
+			if (mode == TMAP_BLIT_MASK && pxl == map->transcolor) draw = 0;
+			if (mode == TMAP_BLIT_TRANSMASK && trans_ptr[pxl]) draw = 0;
 
-				INT32 goffs = 0;
-				if (flipy) { goffs += (cur_map->theight - 1) - (sy % cur_map->theight); } else { goffs += (sy % cur_map->theight); }
-				goffs *= cur_map->twidth;
-				if (flipx) { goffs += (cur_map->twidth  - 1) - (sx % cur_map->twidth);  } else { goffs += (sx % cur_map->twidth); }
+			dst[x] = nPalette + pxl;
+			msk[x] = draw;
+			drawn += draw;
+		}
+	}
 
-				UINT8 *gfxsrc = gfx->gfxbase + (sTileData.code * cur_map->twidth * cur_map->theight) + goffs;
+	*state = (drawn == 0) ? 0 : ((drawn == width * height) ? 1 : 2);
+}
 
-				UINT8 *trans_ptr = cur_map->transparent[category];
+// bring the page up to date, only the dirty tiles unless the draw flags or gfx setup changed.
+// runs before the bands are started, the callbacks are only called from here
+static void GenericTilemapCacheUpdate(GenericTilemapDrawInfo *info)
+{
+	GenericTilemap *map = info->map;
+	INT32 all = 0;
 
-				if (trans_ptr[*gfxsrc] == 0)
-				{
-					Bitmap[y * bitmap_width + x] = *gfxsrc + sTileData.color;
-					pPrioDraw[y * bitmap_width + x] = priority | (pPrioDraw[y * bitmap_width + x] & GenericTilesPRIMASK);
+	if (map->cache_key != info->cache_key || map->cache_serial != nGenericTilemapCacheSerial) {
+		map->cache_key = info->cache_key;
+		map->cache_serial = nGenericTilemapCacheSerial;
+		all = 1;
+	} else if (map->cache_dirty_any == 0) {
+		return;
+	}
+
+	INT32 tiles = map->mwidth * map->mheight;
+
+	for (INT32 offset = 0; offset < tiles; offset++)
+	{
+		if (all || map->cache_dirty[offset]) {
+			GenericTilemapCacheTile(info, offset);
+		}
+	}
+
+	memset (map->cache_dirty, 0, tiles);
+	map->cache_dirty_any = 0;
+}
+
+// copy one tile from the page, clipped like GenericTilemapBlit(), flipscreen applied here
+static void GenericTilemapDrawCachedTile(GenericTilemapDrawInfo *info, INT32 offset, INT32 sx, INT32 sy, INT32 band_miny, INT32 band_maxy)
+{
+	GenericTilemap *map = info->map;
+	INT32 state = map->cache_tile_state[offset];
+	if (state == 0) return;
+
+	INT32 width = map->twidth;
+	INT32 height = map->theight;
+
+	INT32 x0 = (sx < info->minx) ? (info->minx - sx) : 0;
+	INT32 x1 = (sx + width > info->maxx) ? (info->maxx - sx) : width;
+	INT32 y0 = (sy < band_miny) ? (band_miny - sy) : 0;
+	INT32 y1 = (sy + height > band_maxy) ? (band_maxy - sy) : height;
+	if (x0 >= x1 || y0 >= y1) return;
+
+	UINT16 *page = map->cache_page + offset * width * height;
+	UINT8 *mask = map->cache_mask + offset * width * height;
+	INT32 flipx = map->flags & TMAP_FLIPX;
+	INT32 flipy = map->flags & TMAP_FLIPY;
+	UINT8 primask = GenericTilesPRIMASK;
+	UINT8 priority = info->priority;
+
+	for (INT32 y = y0; y < y1; y++)
+	{
+		INT32 row = (flipy ? (height - 1 - y) : y) * width;
+		UINT16 *src = page + row;
+		UINT8 *msk = mask + row;
+		UINT16 *dst = info->Bitmap + (sy + y) * nScreenWidth + sx;
+		UINT8 *pri = pPrioDraw + (sy + y) * nScreenWidth + sx;
+
+		if (flipx) {
+			for (INT32 x = x0; x < x1; x++) {
+				if (msk[width - 1 - x]) {
+					dst[x] = src[width - 1 - x];
+					pri[x] = priority | (pri[x] & primask);
+				}
+			}
+		} else if (state == 1) {
+			memcpy (dst + x0, src + x0, (x1 - x0) * sizeof(UINT16));
+
+			for (INT32 x = x0; x < x1; x++) {
+				pri[x] = priority | (pri[x] & primask);
+			}
+		} else {
+			for (INT32 x = x0; x < x1; x++) {
+				if (msk[x]) {
+					dst[x] = src[x];
+					pri[x] = priority | (pri[x] & primask);
 				}
 			}
 		}
-		
-		return;
 	}
-	// line scroll
-	else if ((cur_map->scrollx_table != NULL) && (cur_map->scroll_rows > cur_map->mheight))
+}
+
+// line scroll
+static void GenericTilemapDrawLineScroll(GenericTilemapDrawInfo *info, INT32 band_miny, INT32 band_maxy)
+{
+	GenericTilemap *map = info->map;
+	struct GenericTilemapCallbackStruct sTileData;
+	UINT32 category;
+
+	INT32 minx = info->minx, maxx = info->maxx, miny = info->miny, maxy = info->maxy;
+	INT32 bitmap_width = maxx - minx;
+
+	for (INT32 y = miny; y < maxy; y++) // line by line
 	{
-		INT32 bitmap_width = maxx - minx;
-		UINT16 *dest = Bitmap;
-		UINT8 *prio = pPrioDraw;
+		INT32 sy = y;
+		if (map->flags & TMAP_FLIPY) {
+			sy = ((maxy - miny) - map->theight) - sy;
+		}
 
-		for (INT32 y = miny; y < maxy; y++, prio += bitmap_width) // line by line
+		if (info->banded && (sy < band_miny || sy >= band_maxy)) continue;
+
+		INT32 scrolly = (map->scrolly + y + info->y_offset) % (map->mheight * map->theight);
+
+		INT32 scrollx = map->scrollx_table[(scrolly * map->scroll_rows) / (map->mheight * map->theight)] - info->x_offset;
+
+		scrollx %= (map->twidth * map->mwidth);
+
+		INT32 row = scrolly / map->theight;
+
+		INT32 scry = scrolly % (map->theight);
+		INT32 scrx = scrollx % (map->twidth);
+
+		UINT16 *dest = info->Bitmap + sy * nScreenWidth;
+		UINT8 *prio = pPrioDraw + sy * nScreenWidth;
+
+		for (UINT32 x = 0; x < bitmap_width + map->twidth; x+=map->twidth)
 		{
-			INT32 scrolly = (cur_map->scrolly + y + y_offset) % (cur_map->mheight * cur_map->theight);
+			INT32 sx = x;
+			INT32 col = ((x + scrollx) % (map->mwidth * map->twidth)) / map->twidth;
+			INT32 offset = map->pScan(col,row);
+
+			GenericTilesGfx *gfx = GenericTilemapGetTile(info, offset, &sTileData, &category);
+			if (gfx == NULL) continue;
 
-			INT32 scrollx = cur_map->scrollx_table[(scrolly * cur_map->scroll_rows) / (cur_map->mheight * cur_map->theight)] - x_offset;
+			sTileData.color = ((sTileData.color & gfx->color_mask) << gfx->depth) + gfx->color_offset;
 
-			scrollx %= (cur_map->twidth * cur_map->mwidth);
+			INT32 flipx = sTileData.flags & TILE_FLIPX; 
+			INT32 flipy = sTileData.flags & TILE_FLIPY;
 
-			INT32 row = scrolly / cur_map->theight;
+			if (map->flags & TMAP_FLIPY) {
+				flipy ^= TILE_FLIPY;
+			}
 
-			INT32 scry = scrolly % (cur_map->theight);
-			INT32 scrx = scrollx % (cur_map->twidth);
+			INT32 scy;
+			if (flipy)
+				scy = (map->theight - 1) - scry;
+			else
+				scy = scry;
 
-			INT32 sy = y;
-			if (cur_map->flags & TMAP_FLIPY) {
-				sy = ((maxy - miny) - cur_map->theight) - sy;
+			if (map->flags & TMAP_FLIPX) {
+				sx = ((maxx - minx) - map->twidth) - sx;
+				scrx = ((map->twidth) - 1) - scrx;
+				flipx ^= TILE_FLIPX;
 			}
 
-			dest = Bitmap + sy * nScreenWidth;
-			prio = pPrioDraw + sy * nScreenWidth;
+			UINT8 *gfxsrc = gfx->gfxbase + (sTileData.code * map->twidth * map->theight) + (scy * map->twidth);
+			UINT8 *trans_ptr = map->transparent[category];
 
-			for (UINT32 x = 0; x < bitmap_width + cur_map->twidth; x+=cur_map->twidth)
+			if (flipx)
 			{
-				INT32 sx = x;
-				INT32 col = ((x + scrollx) % (cur_map->mwidth * cur_map->twidth)) / cur_map->twidth;
-				INT32 offset = cur_map->pScan(col,row);
+				INT32 flip_wide = map->twidth - 1;
 
-				if (cur_map->dirty_tiles_enable) {
-					if (cur_map->dirty_tiles[offset] == 0) continue;
-					cur_map->dirty_tiles[offset] = 0;
-				}
+				for (UINT32 dx = 0; dx < map->twidth; dx++)
+				{
+					INT32 dst = (sx + dx) - scrx;
+					if (dst < minx || dst >= maxx) continue;
 
-				sTileData.category = 0;
-
-				cur_map->pTile(offset, &sTileData);
+					if (trans_ptr[gfxsrc[flip_wide - dx]] == 0) {
+						dest[dst] = sTileData.color + gfxsrc[flip_wide - dx];
+						prio[dst] = info->priority | (prio[dst] & GenericTilesPRIMASK);
+					}
+				}
+			}
+			else
+			{
+				for (UINT32 dx = 0; dx < map->twidth; dx++)
+				{
+					INT32 dst = (sx + dx) - scrx;
+					if (dst < minx || dst >= maxx) continue;
 
-				UINT32 category = sTileData.category | category_or;
-				
-				if (category && (cur_map->flags & TMAP_TRANSMASK)) {
-					if (cur_map->transparent[category] == NULL) {
-						category = 0;
+					if (trans_ptr[gfxsrc[dx]] == 0) {
+						dest[dst] = sTileData.color + gfxsrc[dx];
+						prio[dst] = info->priority | (prio[dst] & GenericTilesPRIMASK);
 					}
 				}
+			}
+		}
+	}
+}
 
-				GenericTilesGfx *gfx = &GenericGfxData[sTileData.gfx];
+// scrollx and scrolly, one scroll row and column. Fast!
+static void GenericTilemapDrawScroll(GenericTilemapDrawInfo *info, INT32 band_miny, INT32 band_maxy)
+{
+	GenericTilemap *map = info->map;
+	struct GenericTilemapCallbackStruct sTileData;
+	UINT32 category;
 
-#if defined FBNEO_DEBUG
-				if (gfx->gfxbase == NULL) {
-					bprintf (PRINT_ERROR,_T("GenericTilemapDraw(%d) gfx[%d] not initialized!\n"), which, sTileData.gfx);
-					continue;
-				}
+	INT32 minx = info->minx, maxx = info->maxx, miny = info->miny, maxy = info->maxy;
 
-				if (((UINT32)gfx->width != cur_map->twidth) || ((UINT32)gfx->height != cur_map->theight))
-				{
-					bprintf (PRINT_ERROR,_T("GenericTilemapDraw(%d) gfx[%d] tile dimensions (%dx%d do not match tilemap tile dimensions (%dx%d)!\n"), which, sTileData.gfx, gfx->width, gfx->height, cur_map->twidth, cur_map->theight);
-					continue;
-				}
+	INT32 syshift = ((map->scrolly - info->y_offset) % map->theight);
+	INT32 scrolly = ((map->scrolly - info->y_offset) / map->theight) * map->theight;
+
+	INT32 sxshift = ((map->scrollx - info->x_offset) % map->twidth);
+	INT32 scrollx = ((map->scrollx - info->x_offset) / map->twidth) * map->twidth;
+
+	// start drawing at tile-border, and let the blitter take care of the sub-tile clipping.
+	INT32 starty = miny - (miny % map->theight);
+	INT32 startx = minx - (minx % map->twidth);
+	INT32 endx = maxx + map->twidth;
+	INT32 endy = maxy + map->theight;
+#if 0
+	// akka arrh buggy (clip) fix
+	// after reimpl, test:
+	// bwings, zaviga, squaitsa, botanicf, bagman
+	// if they are weirdly-offset, something is wrong.
+	if (map->flags & TMAP_FLIPX) {
+		INT32 tmp = ((map->mwidth - 1) * map->twidth) - (endx - map->twidth);
+		endx = (((map->mwidth - 1) * map->twidth) - startx) + map->twidth;
+		startx = tmp;
+	}
+
+	if (map->flags & TMAP_FLIPY) {
+		INT32 tmp = ((map->mheight - 1) * map->theight) - (endy - map->theight);
+		endy = (((map->mheight - 1) * map->theight) - starty) + map->theight;
+		starty = tmp;
+	}
 #endif
 
-				sTileData.code %= gfx->code_mask;
+	for (INT32 y = starty; y < endy; y += map->theight)
+	{
+		INT32 syy = (y + scrolly) % (map->theight * map->mheight);
 
-				if (opaque == 0)
-				{
-					if (cur_map->skip_tiles[sTileData.gfx] && (cur_map->flags & TMAP_TRANSPARENT))	// skip this tile
-						if (cur_map->skip_tiles[sTileData.gfx][sTileData.code])
-							continue; 
+		INT32 sy = y - syshift;
+		if (map->flags & TMAP_FLIPY) {
+			sy = ((maxy - miny) - map->theight) - sy;
+		}
 
-					if (sTileData.flags & TILE_SKIP) continue; // skip this tile
+		// the whole row of tiles is drawn by another band
+		INT32 owned = GenericTilemapBandOwns(info, sy, band_miny, band_maxy);
+		if (info->banded && !owned) continue;
 
-					if (sTileData.flags & TILE_GROUP_ENABLE) {
-						INT32 group = (sTileData.flags >> 16) & 0xff;
+		for (INT32 x = startx; x < endx; x += map->twidth)
+		{
+			INT32 sxx = (x + scrollx) % (map->twidth * map->mwidth);
 
-						if (group != tgroup) {
-							continue;
-						}
-					}
-				}
+			INT32 offset = map->pScan(sxx/map->twidth,syy/map->theight);
 
-				sTileData.color = ((sTileData.color & gfx->color_mask) << gfx->depth) + gfx->color_offset;
+			if (info->cached && (UINT32)offset < map->mwidth * map->mheight) {
+				INT32 sx = x - sxshift;
 
-				INT32 flipx = sTileData.flags & TILE_FLIPX; 
-				INT32 flipy = sTileData.flags & TILE_FLIPY;
+				if (map->flags & TMAP_FLIPX) {
+					sx = ((maxx - minx) - map->twidth) - sx;
+				}
 
-				if (cur_map->flags & TMAP_FLIPY) {
-					flipy ^= TILE_FLIPY;
+				if ((sx < maxx) && (sx >= (INT32)(minx - (map->twidth - 1))) && owned) {
+					GenericTilemapDrawCachedTile(info, offset, sx, sy, miny, maxy);
 				}
+				continue;
+			}
 
-				INT32 scy;
-				if (flipy)
-					scy = (cur_map->theight - 1) - scry;
-				else
-					scy = scry;
+			GenericTilesGfx *gfx = GenericTilemapGetTile(info, offset, &sTileData, &category);
+			if (gfx == NULL) continue;
 
-				if (cur_map->flags & TMAP_FLIPX) {
-					sx = ((maxx - minx) - cur_map->twidth) - sx;
-					scrx = ((cur_map->twidth) - 1) - scrx;
-					flipx ^= TILE_FLIPX;
-				}
+			sTileData.color &= gfx->color_mask;
 
-				UINT8 *gfxsrc = gfx->gfxbase + (sTileData.code * cur_map->twidth * cur_map->theight) + (scy * cur_map->twidth);
-				UINT8 *trans_ptr = cur_map->transparent[category];
+			INT32 sx = x - sxshift;
 
-				if (flipx)
-				{
-					INT32 flip_wide = cur_map->twidth - 1;
+			INT32 flipx = sTileData.flags & TILE_FLIPX; 
+			INT32 flipy = sTileData.flags & TILE_FLIPY;
 
-					for (UINT32 dx = 0; dx < cur_map->twidth; dx++)
-					{
-						INT32 dst = (sx + dx) - scrx;
-						if (dst < minx || dst >= maxx) continue;
+			if (map->flags & TMAP_FLIPY) {
+				flipy ^= TILE_FLIPY;
+			}
 
-						if (trans_ptr[gfxsrc[flip_wide - dx]] == 0) {
-							dest[dst] = sTileData.color + gfxsrc[flip_wide - dx];
-							prio[dst] = priority | (prio[dst] & GenericTilesPRIMASK);
-						}
-					}
-				}
-				else
-				{
-					for (UINT32 dx = 0; dx < cur_map->twidth; dx++)
-					{
-						INT32 dst = (sx + dx) - scrx;
-						if (dst < minx || dst >= maxx) continue;
+			if (map->flags & TMAP_FLIPX) {
+				sx = ((maxx - minx) - map->twidth) - sx;
+				flipx ^= TILE_FLIPX;
+			}
 
-						if (trans_ptr[gfxsrc[dx]] == 0) {
-							dest[dst] = sTileData.color + gfxsrc[dx];
-							prio[dst] = priority | (prio[dst] & GenericTilesPRIMASK);
-						}
-					}
-				}
+			// skip tiles that are out of the visible area
+			if ((sx >= maxx) || (sx < (INT32)(minx - (map->twidth - 1))) || !owned) {
+				continue;
 			}
-		}
 
-		return;
+			GenericTilemapDrawTile(info, &sTileData, gfx, category, sx, sy, flipx, flipy, miny, maxy);
+		}
 	}
-	// scrollx and scrolly
-	else if (cur_map->scroll_rows <= 1 && cur_map->scroll_cols <= 1) // one scroll row and column. Fast!
+}
+
+// column / row scroll (greater >= tile size)
+static void GenericTilemapDrawRowCol(GenericTilemapDrawInfo *info, INT32 band_miny, INT32 band_maxy)
+{
+	GenericTilemap *map = info->map;
+	struct GenericTilemapCallbackStruct sTileData;
+	UINT32 category;
+
+	INT32 minx = info->minx, maxx = info->maxx, miny = info->miny, maxy = info->maxy;
+
+	for (UINT32 offs = 0; offs < (map->mwidth * map->mheight); offs++)
 	{
-		INT32 syshift = ((cur_map->scrolly - y_offset) % cur_map->theight);
-		INT32 scrolly = ((cur_map->scrolly - y_offset) / cur_map->theight) * cur_map->theight;
+		INT32 col = offs % map->mwidth; //x
+		INT32 row = offs / map->mwidth; //y
 
-		INT32 sxshift = ((cur_map->scrollx - x_offset) % cur_map->twidth);
-		INT32 scrollx = ((cur_map->scrollx - x_offset) / cur_map->twidth) * cur_map->twidth;
+		INT32 sx = col * map->twidth;
+		INT32 sy = row * map->theight;
 
-		// start drawing at tile-border, and let RenderCustomTile..Clip() take care of the sub-tile clipping.
-		INT32 starty = miny - (miny % cur_map->theight);
-		INT32 startx = minx - (minx % cur_map->twidth);
-		INT32 endx = maxx + cur_map->twidth;
-		INT32 endy = maxy + cur_map->theight;
-#if 0
-		// akka arrh buggy (clip) fix
-		// after reimpl, test:
-		// bwings, zaviga, squaitsa, botanicf, bagman
-		// if they are weirdly-offset, something is wrong.
-		if (cur_map->flags & TMAP_FLIPX) {
-			INT32 tmp = ((cur_map->mwidth - 1) * cur_map->twidth) - (endx - cur_map->twidth);
-			endx = (((cur_map->mwidth - 1) * cur_map->twidth) - startx) + cur_map->twidth;
-			startx = tmp;
+		if (map->scroll_rows <= 1) {
+			sx -= map->scrollx;
+		} else {
+			INT32 r = (row * map->scroll_rows) / map->mheight;
+			sx -= (map->scrollx + map->scrollx_table[r]) % (map->twidth * map->mwidth);
+		}
+
+		if (map->scroll_cols <= 1) {
+			sy -= map->scrolly;
+		} else {
+			INT32 r = (col * map->scroll_cols) / map->mwidth;
+			sy -= (map->scrolly + map->scrolly_table[r]) % (map->theight * map->mheight);
+		}
+
+		if (sx < (INT32)(1-map->twidth)) sx += map->twidth * map->mwidth;
+		if (sy < (INT32)(1-map->theight)) sy += map->theight * map->mheight;
+
+		sx += info->x_offset;
+		sy += info->y_offset;
+
+		if (map->flags & TMAP_FLIPY) {
+			sy = ((maxy - miny) - map->theight) - sy;
+		}
+
+		if (map->flags & TMAP_FLIPX) {
+			sx = ((maxx - minx) - map->twidth) - sx;
 		}
 
-		if (cur_map->flags & TMAP_FLIPY) {
-			INT32 tmp = ((cur_map->mheight - 1) * cur_map->theight) - (endy - cur_map->theight);
-			endy = (((cur_map->mheight - 1) * cur_map->theight) - starty) + cur_map->theight;
-			starty = tmp;
+		INT32 visible = !((sx >= maxx) || (sx < (INT32)(minx - (map->twidth - 1)))) && GenericTilemapBandOwns(info, sy, band_miny, band_maxy);
+
+		// don't even look the tile up if another band draws it
+		if (info->banded && !visible) continue;
+
+		INT32 offset = map->pScan(col,row);
+
+		if (info->cached && (UINT32)offset < map->mwidth * map->mheight) {
+			if (visible) GenericTilemapDrawCachedTile(info, offset, sx, sy, miny, maxy);
+			continue;
 		}
+
+		GenericTilesGfx *gfx = GenericTilemapGetTile(info, offset, &sTileData, &category);
+		if (gfx == NULL) continue;
+
+		// skip tiles that are out of the visible area
+		if (!visible) continue;
+
+		sTileData.color &= gfx->color_mask;
+
+		INT32 flipx = sTileData.flags & TILE_FLIPX;
+		INT32 flipy = sTileData.flags & TILE_FLIPY;
+
+		if (map->flags & TMAP_FLIPY) flipy ^= TILE_FLIPY;
+		if (map->flags & TMAP_FLIPX) flipx ^= TILE_FLIPX;
+
+		GenericTilemapDrawTile(info, &sTileData, gfx, category, sx, sy, flipx, flipy, miny, maxy);
+	}
+}
+
+static void GenericTilemapDrawBand(INT32 nBand, void *pParam)
+{
+	GenericTilemapDrawInfo *info = (GenericTilemapDrawInfo*)pParam;
+
+	INT32 band_miny = info->miny + nBand * info->band_height;
+	INT32 band_maxy = band_miny + info->band_height;
+	if (band_maxy > info->maxy) band_maxy = info->maxy;
+
+	if (band_miny < band_maxy) {
+		info->pDraw(info, band_miny, band_maxy);
+	}
+}
+
+void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 priority_mask)
+{
+#if defined FBNEO_DEBUG
+	if (Bitmap == NULL) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapDraw(%d, Bitmap, %d); called without initialized Bitmap!\n"), which, priority);
+		return;
+	}
 #endif
-		for (INT32 y = starty; y < endy; y += cur_map->theight)
-		{
-			INT32 syy = (y + scrolly) % (cur_map->theight * cur_map->mheight);
 
-			for (INT32 x = startx; x < endx; x += cur_map->twidth)
+	cur_map = &maps[which];
+
+#if defined FBNEO_DEBUG
+	if (cur_map->initialized == 0) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapDraw(%d, Bitmap, %d); called without initialized tilemap!\n"), which, priority);
+		return;
+	}
+#endif
+
+	if (cur_map->enable == 0) { // layer disabled!
+		return;
+	}
+
+	INT32 minx, maxx, miny, maxy;
+	GenericTilesGetClip(&minx, &maxx, &miny, &maxy);
+
+	// check clipping and fix clipping sizes if out of bounds
+	if (minx < 0 || maxx > nScreenWidth || miny < 0 || maxy > nScreenHeight) {
+		bprintf (PRINT_ERROR, _T("GenericTilemapDraw(%d, Bitmap, %d) called with improper clipping values (%d, %d, %d, %d)!"), which, priority, minx, maxx, miny, maxy);
+		bprintf (PRINT_ERROR, _T("pPrioDraw is %d pixels wide and %d pixels high!\n"), nScreenWidth, nScreenHeight);
+
+		if (minx < 0) minx = 0;
+		if (maxx >= nScreenWidth) maxx = nScreenWidth;
+		if (miny < 0) miny = 0;
+		if (maxy >= nScreenHeight) maxy = nScreenHeight;
+	}
+
+	GenericTilesPRIMASK = priority_mask;
+
+	INT32 category_or = (priority & TMAP_DRAWLAYER1) ? 2 : 0;
+	INT32 opaque = priority & TMAP_FORCEOPAQUE;
+	INT32 opaque2 = priority & TMAP_DRAWOPAQUE;
+	INT32 tgroup = (priority >> 8) & 0xff;
+	INT32 cache_key = priority & ~0xff;
+	priority &= 0xff;
+
+	INT32 x_offset = cur_map->xoffset[(cur_map->flags & TMAP_FLIPX) ? 1 : 0];
+	INT32 y_offset = cur_map->yoffset[(cur_map->flags & TMAP_FLIPY) ? 1 : 0];
+
+	struct GenericTilemapCallbackStruct sTileData;
+
+	// column (less than tile size) and line scroll
+	if ((cur_map->scrolly_table != NULL) && (cur_map->scroll_cols > cur_map->mwidth))
+	{
+		INT32 bitmap_width = maxx - minx;
+		INT32 scrymod = (cur_map->mheight * cur_map->theight);
+		INT32 scrxmod = (cur_map->mwidth * cur_map->twidth);
+
+		for (INT32 y = miny; y < maxy; y++)
+		{
+			for (INT32 x = 0; x < bitmap_width; x++)
 			{
-				INT32 sxx = (x + scrollx) % (cur_map->twidth * cur_map->mwidth);
+				INT32 sx;
+				if (cur_map->scrollx_table != NULL)
+					sx = (x + cur_map->scrollx_table[(y * cur_map->scroll_rows) / scrymod] - x_offset) % scrxmod;
+				else
+					sx = (x + cur_map->scrolly - x_offset) % scrxmod;
+
+				INT32 sy = (y + cur_map->scrolly_table[(sx * cur_map->scroll_cols) / scrxmod] - y_offset) % scrymod;
 
-				INT32 offset = cur_map->pScan(sxx/cur_map->twidth,syy/cur_map->theight);
+				INT32 row = sy / cur_map->theight;
+				INT32 col = sx / cur_map->twidth;
+
+				INT32 by = sy;
+				if (cur_map->flags & TMAP_FLIPY) {
+					by = (bitmap_width - cur_map->theight) - by;
+				}
+
+				INT32 bx = sx;
+				if (cur_map->flags & TMAP_FLIPX) {
+					bx = (bitmap_width - cur_map->twidth) - bx;
+				}
+
+				INT32 offset = cur_map->pScan(col,row);
 
 				if (cur_map->dirty_tiles_enable) {
 					if (cur_map->dirty_tiles[offset] == 0) continue;
@@ -1207,7 +1642,7 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 				cur_map->pTile(offset, &sTileData);
 
 				UINT32 category = sTileData.category | category_or;
-
+				
 				if (category && (cur_map->flags & TMAP_TRANSMASK)) {
 					if (cur_map->transparent[category] == NULL) {
 						category = 0;
@@ -1230,365 +1665,107 @@ void GenericTilemapDraw(INT32 which, UINT16 *Bitmap, INT32 priority, INT32 prior
 #endif
 
 				sTileData.code %= gfx->code_mask;
+				GenericGfxCheckTile(gfx, sTileData.code);
 
 				if (opaque == 0)
 				{
-					if (cur_map->skip_tiles[sTileData.gfx] && (cur_map->flags & TMAP_TRANSPARENT)) {	// skip this tile
-						if (cur_map->skip_tiles[sTileData.gfx][sTileData.code]) {
-							continue;
-						}
-					}
+					if (cur_map->skip_tiles[sTileData.gfx] && (cur_map->flags & TMAP_TRANSPARENT))	// skip this tile
+						if (cur_map->skip_tiles[sTileData.gfx][sTileData.code])
+							continue; 
 
 					if (sTileData.flags & TILE_SKIP) continue; // skip this tile
 
 					if (sTileData.flags & TILE_GROUP_ENABLE) {
 						INT32 group = (sTileData.flags >> 16) & 0xff;
-	
+
 						if (group != tgroup) {
 							continue;
 						}
 					}
 				}
 
-				sTileData.color &= gfx->color_mask;
-
-				INT32 sy = y - syshift;
-				INT32 sx = x - sxshift;
+				sTileData.color = ((sTileData.color & gfx->color_mask) << gfx->depth) + gfx->color_offset;
 
 				INT32 flipx = sTileData.flags & TILE_FLIPX; 
 				INT32 flipy = sTileData.flags & TILE_FLIPY;
+				if (cur_map->flags & TMAP_FLIPY) flipy ^= TILE_FLIPY;
+				if (cur_map->flags & TMAP_FLIPX) flipy ^= TILE_FLIPX;
 
-				if (cur_map->flags & TMAP_FLIPY) {
-					// part of clip fix (save for reimpl)
-					//sy = ((cur_map->mheight - 1) * cur_map->theight) - sy;
-					sy = ((maxy - miny) - cur_map->theight) - sy;
-					flipy ^= TILE_FLIPY;
-				}
+				INT32 goffs = 0;
+				if (flipy) { goffs += (cur_map->theight - 1) - (sy % cur_map->theight); } else { goffs += (sy % cur_map->theight); }
+				goffs *= cur_map->twidth;
+				if (flipx) { goffs += (cur_map->twidth  - 1) - (sx % cur_map->twidth);  } else { goffs += (sx % cur_map->twidth); }
 
-				if (cur_map->flags & TMAP_FLIPX) {
-					// part of clipc fix (save for reimpl)
-					//sx = ((cur_map->mwidth - 1) * cur_map->twidth) - sx;
-					sx = ((maxx - minx) - cur_map->twidth) - sx;
-					flipx ^= TILE_FLIPX;
-				}
+				UINT8 *gfxsrc = gfx->gfxbase + (sTileData.code * cur_map->twidth * cur_map->theight) + goffs;
 
-				// skip tiles that are out of the visible area
-				if ((sx >= maxx) || (sy >= maxy) || (sx < (INT32)(minx - (cur_map->twidth - 1))) || (sy < (INT32)(miny - (cur_map->theight - 1)))) {
-					continue;
-				}
+				UINT8 *trans_ptr = cur_map->transparent[category];
 
-				if (sx < minx || sy < miny || sx >= (INT32)(maxx - cur_map->twidth - 1) || sy >= (INT32)(maxy - cur_map->theight - 1))
-				{
-					if ((cur_map->flags & TMAP_TRANSPARENT) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
-					{
-						if (flipy) {
-							if (flipx) {
-								RenderCustomTile_Prio_Mask_FlipXY_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-							} else {
-								RenderCustomTile_Prio_Mask_FlipY_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-							}
-						} else {
-							if (flipx) {
-								RenderCustomTile_Prio_Mask_FlipX_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-							} else {
-								RenderCustomTile_Prio_Mask_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-							}
-						}
-					}
-					else if ((cur_map->flags & TMAP_TRANSMASK) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
-					{
-						if (flipy) {
-							if (flipx) {
-								RenderCustomTile_Prio_TransMask_FlipXY_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-							} else {
-								RenderCustomTile_Prio_TransMask_FlipY_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-							}
-						} else {
-							if (flipx) {
-								RenderCustomTile_Prio_TransMask_FlipX_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-							} else {
-								RenderCustomTile_Prio_TransMask_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-							}
-						}	
-					}
-					else
-					{
-						if (flipy) {
-							if (flipx) {
-								RenderCustomTile_Prio_FlipXY_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-							} else {
-								RenderCustomTile_Prio_FlipY_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-							}
-						} else {
-							if (flipx) {
-								RenderCustomTile_Prio_FlipX_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-							} else {
-								RenderCustomTile_Prio_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-							}
-						}
-					}
-				} 
-				else
+				if (trans_ptr[*gfxsrc] == 0)
 				{
-					if ((cur_map->flags & TMAP_TRANSPARENT) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
-					{
-						if (flipy) {
-							if (flipx) {
-								RenderCustomTile_Prio_Mask_FlipXY(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-							} else {
-								RenderCustomTile_Prio_Mask_FlipY(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-							}
-						} else {
-							if (flipx) {
-								RenderCustomTile_Prio_Mask_FlipX(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-							} else {
-								RenderCustomTile_Prio_Mask(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-							}
-						}
-					}
-					else if ((cur_map->flags & TMAP_TRANSMASK) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
-					{
-						if (flipy) {
-							if (flipx) {
-								RenderCustomTile_Prio_TransMask_FlipXY(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-							} else {
-								RenderCustomTile_Prio_TransMask_FlipY(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-							}
-						} else {
-							if (flipx) {
-								RenderCustomTile_Prio_TransMask_FlipX(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-							} else {
-								RenderCustomTile_Prio_TransMask(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-							}
-						}	
-					}
-					else
-					{
-						if (flipy) {
-							if (flipx) {
-								RenderCustomTile_Prio_FlipXY(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-							} else {
-								RenderCustomTile_Prio_FlipY(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-							}
-						} else {
-							if (flipx) {
-								RenderCustomTile_Prio_FlipX(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-							} else {
-								RenderCustomTile_Prio(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-							}
-						}
-					}
+					Bitmap[y * bitmap_width + x] = *gfxsrc + sTileData.color;
+					pPrioDraw[y * bitmap_width + x] = priority | (pPrioDraw[y * bitmap_width + x] & GenericTilesPRIMASK);
 				}
 			}
 		}
-
+		
 		return;
 	}
-
-	// column / row scroll (greater >= tile size)
-	for (UINT32 offs = 0; offs < (cur_map->mwidth * cur_map->mheight); offs++)
-	{
-		INT32 col = offs % cur_map->mwidth; //x
-		INT32 row = offs / cur_map->mwidth; //y
-
-		INT32 offset = cur_map->pScan(col,row);
-
-		if (cur_map->dirty_tiles_enable) {
-			if (cur_map->dirty_tiles[offset] == 0) continue;
-			cur_map->dirty_tiles[offset] = 0;
-		}
-
-		sTileData.category = 0;
-
-		cur_map->pTile(offset, &sTileData);
-
-		UINT32 category = sTileData.category | category_or;
-
-		if (category && (cur_map->flags & TMAP_TRANSMASK)) {
-			if (cur_map->transparent[category] == NULL) {
-				category = 0;
-			}
-		}
-
-		GenericTilesGfx *gfx = &GenericGfxData[sTileData.gfx];
-
-#if defined FBNEO_DEBUG
-		if (gfx->gfxbase == NULL) {
-			bprintf (PRINT_ERROR,_T("GenericTilemapDraw(%d) gfx[%d] not initialized!\n"), which, sTileData.gfx);
-			continue;
-		}
-
-		if (((UINT32)gfx->width != cur_map->twidth) || ((UINT32)gfx->height != cur_map->theight))
-		{
-			bprintf (PRINT_ERROR,_T("GenericTilemapDraw(%d) gfx[%d] tile dimensions (%dx%d do not match tilemap tile dimensions (%dx%d)!\n"), which, sTileData.gfx, gfx->width, gfx->height, cur_map->twidth, cur_map->theight);
-			continue;
-		}
-#endif
-
-		sTileData.code %= gfx->code_mask;
-
-		if (opaque == 0)
-		{
-			if (cur_map->skip_tiles[sTileData.gfx] && (cur_map->flags & TMAP_TRANSPARENT))	// skip this tile
-				if (cur_map->skip_tiles[sTileData.gfx][sTileData.code])
-					continue; 
-
-			if (sTileData.flags & TILE_SKIP) continue; // skip this tile
-
-			if (sTileData.flags & TILE_GROUP_ENABLE) {
-				INT32 group = (sTileData.flags >> 16) & 0xff;
-
-				if (group != tgroup) {
-					continue;
-				}
-			}
-		}
-
-		sTileData.color &= gfx->color_mask;
-
-		INT32 sx = col * cur_map->twidth;
-		INT32 sy = row * cur_map->theight;
-
-		if (cur_map->scroll_rows <= 1) {
-			sx -= cur_map->scrollx;
+	GenericTilemapDrawInfo info;
+
+	info.map = cur_map;
+	info.which = which;
+	info.Bitmap = Bitmap;
+	info.priority = priority;
+	info.category_or = category_or;
+	info.opaque = opaque;
+	info.opaque2 = opaque2;
+	info.tgroup = tgroup;
+	info.x_offset = x_offset;
+	info.y_offset = y_offset;
+	info.minx = minx;
+	info.maxx = maxx;
+	info.miny = miny;
+	info.maxy = maxy;
+	info.cache_key = cache_key;
+	info.cached = 0;
+
+	if ((cur_map->scrollx_table != NULL) && (cur_map->scroll_rows > cur_map->mheight)) {
+		info.pDraw = GenericTilemapDrawLineScroll;
+	} else {
+		if (cur_map->scroll_rows <= 1 && cur_map->scroll_cols <= 1) {
+			info.pDraw = GenericTilemapDrawScroll;
 		} else {
-			INT32 r = (row * cur_map->scroll_rows) / cur_map->mheight;
-			sx -= (cur_map->scrollx + cur_map->scrollx_table[r]) % (cur_map->twidth * cur_map->mwidth);
+			info.pDraw = GenericTilemapDrawRowCol;
 		}
 
-		if (cur_map->scroll_cols <= 1) {
-			sy -= cur_map->scrolly;
-		} else {
-			INT32 r = (col * cur_map->scroll_cols) / cur_map->mwidth;
-			sy -= (cur_map->scrolly + cur_map->scrolly_table[r]) % (cur_map->theight * cur_map->mheight);
-		}
-
-		if (sx < (INT32)(1-cur_map->twidth)) sx += cur_map->twidth * cur_map->mwidth;
-		if (sy < (INT32)(1-cur_map->theight)) sy += cur_map->theight * cur_map->mheight;
-
-		INT32 flipx = sTileData.flags & TILE_FLIPX;
-		INT32 flipy = sTileData.flags & TILE_FLIPY;
-
-		sx += x_offset;
-		sy += y_offset;
-
-		if (cur_map->flags & TMAP_FLIPY) {
-			sy = ((maxy - miny) - cur_map->theight) - sy;
-			flipy ^= TILE_FLIPY;
+		// the dirty tiles system skips whatever isn't dirty, it doesn't mix with the page
+		if (cur_map->cache_page && cur_map->dirty_tiles_enable == 0) {
+			GenericTilemapCacheUpdate(&info);
+			info.cached = 1;
 		}
+	}
 
-		if (cur_map->flags & TMAP_FLIPX) {
-			sx = ((maxx - minx) - cur_map->twidth) - sx;
-			flipx ^= TILE_FLIPX;
-		}
+	// split the layer into horizontal bands for the worker pool (nBurnThreads), the tiles
+	// of one band don't overlap those of another, so the result is the same.  only for
+	// layers the driver opted in (GenericTilemapUseThreads), as the scan and tile callbacks
+	// then run on several threads at once.  dirty tiles are cleared as they are drawn,
+	// those layers have to stay in one piece, as do all layers while lazily decoded
+	// graphics (GenericTilesSetGfxLazy) are still missing pages.
+	INT32 nThreads = BurnThreadCount();
+	INT32 nBands = 1;
 
-		// skip tiles that are out of the visible area
-		if ((sx >= maxx) || (sy >= maxy) || (sx < (INT32)(minx - (cur_map->twidth - 1))) || (sy < (INT32)(miny - (cur_map->theight - 1)))) {
-			continue;
-		}
+	if (nThreads > 1 && cur_map->threaded && cur_map->dirty_tiles_enable == 0 && GenericGfxLazyPending() == 0) {
+		nBands = nThreads * 2;	// a few more than threads, so uneven bands even out
+		if (nBands > (maxy - miny) / 8) nBands = (maxy - miny) / 8;
+	}
 
-		if (sx < minx || sy < miny || sx >= (INT32)(maxx - cur_map->twidth - 1) || sy >= (INT32)(maxy - cur_map->theight - 1))
-		{
-			if ((cur_map->flags & TMAP_TRANSPARENT) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
-			{
-				if (flipy) {
-					if (flipx) {
-						RenderCustomTile_Prio_Mask_FlipXY_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-					} else {
-						RenderCustomTile_Prio_Mask_FlipY_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-					}
-				} else {
-					if (flipx) {
-						RenderCustomTile_Prio_Mask_FlipX_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-					} else {
-						RenderCustomTile_Prio_Mask_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-					}
-				}
-			}
-			else if ((cur_map->flags & TMAP_TRANSMASK) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
-			{
-				if (flipy) {
-					if (flipx) {
-						RenderCustomTile_Prio_TransMask_FlipXY_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-					} else {
-						RenderCustomTile_Prio_TransMask_FlipY_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-					}
-				} else {
-					if (flipx) {
-						RenderCustomTile_Prio_TransMask_FlipX_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-					} else {
-						RenderCustomTile_Prio_TransMask_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-					}
-				}	
-			}
-			else
-			{
-				if (flipy) {
-					if (flipx) {
-						RenderCustomTile_Prio_FlipXY_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-					} else {
-						RenderCustomTile_Prio_FlipY_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-					}
-				} else {
-					if (flipx) {
-						RenderCustomTile_Prio_FlipX_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-					} else {
-						RenderCustomTile_Prio_Clip(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-					}
-				}
-			}
-		} 
-		else
-		{
-			if ((cur_map->flags & TMAP_TRANSPARENT) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
-			{
-				if (flipy) {
-					if (flipx) {
-						RenderCustomTile_Prio_Mask_FlipXY(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-					} else {
-						RenderCustomTile_Prio_Mask_FlipY(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-					}
-				} else {
-					if (flipx) {
-						RenderCustomTile_Prio_Mask_FlipX(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-					} else {
-						RenderCustomTile_Prio_Mask(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transcolor, gfx->color_offset, priority, gfx->gfxbase);
-					}
-				}
-			}
-			else if ((cur_map->flags & TMAP_TRANSMASK) && (sTileData.flags & TILE_OPAQUE) == 0 && opaque == 0 && opaque2 == 0)
-			{
-				if (flipy) {
-					if (flipx) {
-						RenderCustomTile_Prio_TransMask_FlipXY(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-					} else {
-						RenderCustomTile_Prio_TransMask_FlipY(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-					}
-				} else {
-					if (flipx) {
-						RenderCustomTile_Prio_TransMask_FlipX(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-					} else {
-						RenderCustomTile_Prio_TransMask(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, cur_map->transparent[category], gfx->color_offset, priority, gfx->gfxbase);
-					}
-				}	
-			}
-			else
-			{
-				if (flipy) {
-					if (flipx) {
-						RenderCustomTile_Prio_FlipXY(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-					} else {
-						RenderCustomTile_Prio_FlipY(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-					}
-				} else {
-					if (flipx) {
-						RenderCustomTile_Prio_FlipX(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-					} else {
-						RenderCustomTile_Prio(Bitmap, cur_map->twidth, cur_map->theight, sTileData.code, sx, sy, sTileData.color, gfx->depth, gfx->color_offset, priority, gfx->gfxbase);
-					}
-				}
-			}
-		}
+	if (nBands > 1) {
+		info.banded = 1;
+		info.band_height = ((maxy - miny) + nBands - 1) / nBands;
+		BurnThreadRun(GenericTilemapDrawBand, nBands, &info);
+	} else {
+		info.banded = 0;
+		info.pDraw(&info, miny, maxy);
 	}
 }
 
@@ -1725,6 +1902,7 @@ void GenericTilemapDumpToBitmap()
 
 					{
 						GenericTilesGfx *gfxptr = &GenericGfxData[sTileData.gfx];
+						GenericGfxCheckTile(gfxptr, sTileData.code % gfxptr->code_mask);
 
 						UINT8 *gfx = gfxptr->gfxbase + ((sTileData.code % gfxptr->code_mask) * gfxptr->width * gfxptr->height);
 
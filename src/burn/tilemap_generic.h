@@ -164,6 +164,18 @@ void GenericTilemapSetEnable(INT32 which, INT32 enable);
 // Enable using the dirty tiles system for this tilemap
 void GenericTilemapUseDirtyTiles(INT32 which);
 
+// Let GenericTilemapDraw split this tilemap into bands drawn on the worker threads (nBurnThreads).
+// Only for tilemaps whose scan and tile callbacks just read driver state, they are called from
+// several threads at once!
+void GenericTilemapUseThreads(INT32 which);
+
+// Keep every tile of this tilemap pre-rendered in a full size page, only dirty tiles are drawn
+// again and GenericTilemapDraw copies the visible tiles from the page. Only for layers where the
+// driver marks every change of the tile ram (or of anything read by the tile callback, or of the
+// gfx) with GenericTilemapSetTileDirty / GenericTilemapAllTilesDirty! Line scroll and sub-tile
+// column scroll still draw the normal way.
+void GenericTilemapUseCache(INT32 which);
+
 // Mark tile as dirty (note that offset will be %= map_height * map_width!!)
 void GenericTilemapSetTileDirty(INT32 which, UINT32 offset);
 
@@ -14,6 +14,16 @@ Otherwise, use the Transfer code as usual.
 ================================================================================================*/
 
 #include "tiles_generic.h"
+#include "burn_thread.h"
+#include "burn_profile.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TILES_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TILES_NEON
+#include <arm_neon.h>
+#endif
 
 UINT8* pTileData;
 INT32 nScreenWidth, nScreenHeight;
@@ -21,6 +31,9 @@ static INT32 nScreenWidthMax, nScreenHeightMax, nScreenWidthMin, nScreenHeightMi
 
 UINT8 GenericTilesPRIMASK = 0x00;
 
+static void GenericGfxLazyWarm();
+static void GenericGfxLazyExit();
+
 INT32 GenericTilesInit()
 {
 	Debug_GenericTilesInitted = 1;
@@ -56,6 +69,9 @@ INT32 GenericTilesExit()
 
 	BurnTransferExit();
 
+	GfxDecodeSingleExit();
+	GenericGfxLazyExit();
+
 	Debug_GenericTilesInitted = 0;
 
 	GenericTilemapExit();
@@ -181,6 +197,8 @@ INT32 BurnTransferCopy(UINT32* pPalette)
 	if (!Debug_BurnTransferInitted) bprintf(PRINT_ERROR, _T("BurnTransferCopy called without init\n"));
 #endif
 
+	GenericGfxLazyWarm();
+
 	UINT16* pSrc = pTransDraw;
 	UINT8* pDest = pBurnDraw;
 
@@ -309,46 +327,20 @@ inline static INT32 readbit(const UINT8 *src, INT32 bitnum)
 	return src[bitnum / 8] & (0x80 >> (bitnum % 8));
 }
 
-void GfxDecode(INT32 num, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest)
-{
-	INT32 c;
-
-	for (c = 0; c < num; c++) {
-		INT32 plane, x, y;
-
-		UINT8 *dp = pDest + (c * xSize * ySize);
-		memset(dp, 0, xSize * ySize);
-
-		for (plane = 0; plane < numPlanes; plane++) {
-			INT32 planebit = 1 << (numPlanes - 1 - plane);
-			INT32 planeoffs = (c * modulo) + planeoffsets[plane];
-
-			for (y = 0; y < ySize; y++) {
-				INT32 yoffs = planeoffs + yoffsets[y];
-				dp = pDest + (c * xSize * ySize) + (y * xSize);
-
-				for (x = 0; x < xSize; x++) {
-					if (readbit(pSrc, yoffs + xoffsets[x])) dp[x] |= planebit;
-				}
-			}
-		}
-	}
-}
-
-void GfxDecodeSingle(INT32 which, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest)
+static void GfxDecodeTileGeneric(INT32 c, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest)
 {
 	INT32 plane, x, y;
 
-	UINT8 *dp = pDest + (which * xSize * ySize);
+	UINT8 *dp = pDest + (c * xSize * ySize);
 	memset(dp, 0, xSize * ySize);
 
 	for (plane = 0; plane < numPlanes; plane++) {
 		INT32 planebit = 1 << (numPlanes - 1 - plane);
-		INT32 planeoffs = (which * modulo) + planeoffsets[plane];
+		INT32 planeoffs = (c * modulo) + planeoffsets[plane];
 
 		for (y = 0; y < ySize; y++) {
 			INT32 yoffs = planeoffs + yoffsets[y];
-			dp = pDest + (which * xSize * ySize) + (y * xSize);
+			dp = pDest + (c * xSize * ySize) + (y * xSize);
 
 			for (x = 0; x < xSize; x++) {
 				if (readbit(pSrc, yoffs + xoffsets[x])) dp[x] |= planebit;
@@ -357,701 +349,838 @@ void GfxDecodeSingle(INT32 which, INT32 numPlanes, INT32 xSize, INT32 ySize, INT
 	}
 }
 
-//================================================================================================
+// When every tile row starts on a byte boundary (modulo and all the y offsets are whole
+// bytes), a given byte of a row always ends up in the same pixels and planes.  That holds
+// for the usual planar (8 pixels of one plane per byte) and packed (2 pixels of 4 planes,
+// or 1 pixel of 8) layouts, in any order.  If each byte stays within 8 neighbouring pixels
+// its contribution to the row is looked up for all 256 values once, and a row is then
+// decoded with one lookup per source byte instead of a readbit() per pixel and plane.
+// Anything else goes through GfxDecodeTileGeneric().
 
-#define PLOTPIXEL_PRIO(x) { pPixel[x] = nPalette + pTileData[x]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_PRIO_FLIPX(x, a) { pPixel[x] = nPalette + pTileData[a]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_PRIO_MASK(x, mc) if (pTileData[x] != mc) { pPixel[x] = nPalette + pTileData[x]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_PRIO_MASK_FLIPX(x, a, mc) if (pTileData[a] != mc) { pPixel[x] = nPalette + pTileData[a]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
+#define GFX_PLAN_MAX_BYTES	64
 
-#define PLOTPIXEL(x) pPixel[x] = nPalette + pTileData[x];
-#define PLOTPIXEL_FLIPX(x, a) pPixel[x] = nPalette + pTileData[a];
-#define PLOTPIXEL_MASK(x, mc) if (pTileData[x] != mc) {pPixel[x] = nPalette + pTileData[x];}
-#define PLOTPIXEL_MASK_FLIPX(x, a, mc) if (pTileData[a] != mc) {pPixel[x] = nPalette + pTileData[a] ;}
+struct GfxDecodePlan {
+	INT32 nBytes;							// source bytes used by a row
+	INT32 nOffset[GFX_PLAN_MAX_BYTES];		// byte offset from the start of the row
+	INT32 nPixel[GFX_PLAN_MAX_BYTES];		// first of the 8 pixels the byte is looked up for
+	UINT64 *pTable;							// [nBytes][256], 8 pixels per entry
+};
 
-#define PLOTPIXEL_PRIO_TRANSMASK(x) if (pTransTable[pTileData[x]] == 0) { pPixel[x] = nPalette + pTileData[x]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_PRIO_TRANSMASK_FLIPX(x, a) if (pTransTable[pTileData[a]] == 0) { pPixel[x] = nPalette + pTileData[a]; pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK); }
-#define PLOTPIXEL_TRANSMASK(x) if (pTransTable[pTileData[x]] == 0) { pPixel[x] = nPalette + pTileData[x];}
-#define PLOTPIXEL_TRANSMASK_FLIPX(x, a) if (pTransTable[pTileData[a]] == 0) { pPixel[x] = nPalette + pTileData[a] ;}
+static INT32 GfxDecodePlanInit(GfxDecodePlan *plan, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo)
+{
+	INT32 nMinX[GFX_PLAN_MAX_BYTES], nMaxX[GFX_PLAN_MAX_BYTES];
 
-#define CLIPPIXEL(x, sx, a) if ((sx + x) >= nScreenWidthMin && (sx + x) < nScreenWidthMax) { a; };
+	plan->nBytes = 0;
+	plan->pTable = NULL;
 
-/*================================================================================================
-8 x 8 Functions
-================================================================================================*/
+	if (numPlanes < 1 || numPlanes > 8 || xSize < 8 || (modulo & 7)) return 1;
 
-void Render8x8Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile called without init\n"));
-#endif
+	for (INT32 y = 0; y < ySize; y++) {
+		if (yoffsets[y] & 7) return 1;
+	}
+
+	for (INT32 plane = 0; plane < numPlanes; plane++) {
+		for (INT32 x = 0; x < xSize; x++) {
+			INT32 o = planeoffsets[plane] + xoffsets[x];
+			if (o < 0) return 1;
+
+			INT32 k = 0;
+			while (k < plan->nBytes && plan->nOffset[k] != (o >> 3)) k++;
 
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+			if (k == plan->nBytes) {
+				if (k == GFX_PLAN_MAX_BYTES) return 1;
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
+				plan->nOffset[k] = o >> 3;
+				nMinX[k] = nMaxX[k] = x;
+				plan->nBytes++;
+			}
 
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL(0);
-		PLOTPIXEL(1);
-		PLOTPIXEL(2);
-		PLOTPIXEL(3);
-		PLOTPIXEL(4);
-		PLOTPIXEL(5);
-		PLOTPIXEL(6);
-		PLOTPIXEL(7);
+			if (x < nMinX[k]) nMinX[k] = x;
+			if (x > nMaxX[k]) nMaxX[k] = x;
+		}
 	}
-}
 
-void Render8x8Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Clip called without init\n"));
-#endif
+	for (INT32 k = 0; k < plan->nBytes; k++) {
+		if (nMaxX[k] - nMinX[k] >= 8) return 1;
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+		plan->nPixel[k] = (nMinX[k] > xSize - 8) ? (xSize - 8) : nMinX[k];
+	}
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
+	plan->pTable = (UINT64*)calloc(plan->nBytes * 256, sizeof(UINT64));
+	if (plan->pTable == NULL) return 1;
 
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+	for (INT32 plane = 0; plane < numPlanes; plane++) {
+		INT32 planebit = 1 << (numPlanes - 1 - plane);
+
+		for (INT32 x = 0; x < xSize; x++) {
+			INT32 o = planeoffsets[plane] + xoffsets[x];
+			INT32 k = 0;
+			while (plan->nOffset[k] != (o >> 3)) k++;
 
-		CLIPPIXEL(0, StartX, PLOTPIXEL(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL(7));
+			// the entries are OR'd into the row as 8 bytes, so they're built a byte at a time too
+			UINT8 *pEntry = (UINT8*)(plan->pTable + k * 256) + (x - plan->nPixel[k]);
+
+			for (INT32 v = 0; v < 256; v++) {
+				if (v & (0x80 >> (o & 7))) pEntry[v * sizeof(UINT64)] |= planebit;
+			}
+		}
 	}
+
+	return 0;
 }
 
-void Render8x8Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+static void GfxDecodePlanExit(GfxDecodePlan *plan)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_FLIPX(7, 0);
-		PLOTPIXEL_FLIPX(6, 1);
-		PLOTPIXEL_FLIPX(5, 2);
-		PLOTPIXEL_FLIPX(4, 3);
-		PLOTPIXEL_FLIPX(3, 4);
-		PLOTPIXEL_FLIPX(2, 5);
-		PLOTPIXEL_FLIPX(1, 6);
-		PLOTPIXEL_FLIPX(0, 7);
-	}
+	free(plan->pTable);
+	plan->pTable = NULL;
+	plan->nBytes = 0;
 }
 
-void Render8x8Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+static void GfxDecodeTilePlan(GfxDecodePlan *plan, INT32 c, INT32 xSize, INT32 ySize, INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipX_Clip called without init\n"));
-#endif
+	UINT8 *dp = pDest + (c * xSize * ySize);
+	memset(dp, 0, xSize * ySize);
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+	for (INT32 y = 0; y < ySize; y++, dp += xSize) {
+		const UINT8 *sp = pSrc + (c * (modulo >> 3)) + (yoffsets[y] >> 3);
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
+		for (INT32 k = 0; k < plan->nBytes; k++) {
+			UINT8 v = sp[plan->nOffset[k]];
 
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
+			if (v) {
+				UINT64 d;
+				memcpy(&d, dp + plan->nPixel[k], sizeof(d));
+				d |= plan->pTable[k * 256 + v];
+				memcpy(dp + plan->nPixel[k], &d, sizeof(d));
+			}
 		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_FLIPX(0, 7));
 	}
 }
 
-void Render8x8Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+// tiles are decoded in chunks across the worker pool (nBurnThreads), each tile only
+// writes its own part of pDest
+#define GFX_DECODE_CHUNK	256
+
+struct GfxDecodeJob {
+	GfxDecodePlan *plan;
+	INT32 num, numPlanes, xSize, ySize, modulo;
+	INT32 *planeoffsets, *xoffsets, *yoffsets;
+	UINT8 *pSrc, *pDest;
+};
+
+static void GfxDecodeChunk(INT32 nIndex, void *pParam)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipY called without init\n"));
-#endif
+	GfxDecodeJob *job = (GfxDecodeJob*)pParam;
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL(0);
-		PLOTPIXEL(1);
-		PLOTPIXEL(2);
-		PLOTPIXEL(3);
-		PLOTPIXEL(4);
-		PLOTPIXEL(5);
-		PLOTPIXEL(6);
-		PLOTPIXEL(7);
+	INT32 nEnd = (nIndex + 1) * GFX_DECODE_CHUNK;
+	if (nEnd > job->num) nEnd = job->num;
+
+	for (INT32 c = nIndex * GFX_DECODE_CHUNK; c < nEnd; c++) {
+		if (job->plan) {
+			GfxDecodeTilePlan(job->plan, c, job->xSize, job->ySize, job->yoffsets, job->modulo, job->pSrc, job->pDest);
+		} else {
+			GfxDecodeTileGeneric(c, job->numPlanes, job->xSize, job->ySize, job->planeoffsets, job->xoffsets, job->yoffsets, job->modulo, job->pSrc, job->pDest);
+		}
 	}
 }
 
-void Render8x8Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+void GfxDecode(INT32 num, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipY_Clip called without init\n"));
-#endif
+	GfxDecodePlan plan;
+	GfxDecodeJob job;
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+	BurnProfileBegin("GfxDecode");
 
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
+	// a handful of tiles isn't worth building the tables for
+	bool bPlan = (num >= 16) && (GfxDecodePlanInit(&plan, numPlanes, xSize, ySize, planeoffsets, xoffsets, yoffsets, modulo) == 0);
 
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+	job.plan = bPlan ? &plan : NULL;
+	job.num = num;
+	job.numPlanes = numPlanes;
+	job.xSize = xSize;
+	job.ySize = ySize;
+	job.modulo = modulo;
+	job.planeoffsets = planeoffsets;
+	job.xoffsets = xoffsets;
+	job.yoffsets = yoffsets;
+	job.pSrc = pSrc;
+	job.pDest = pDest;
 
-		CLIPPIXEL(0, StartX, PLOTPIXEL(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL(7));
+	INT32 nChunks = (num + GFX_DECODE_CHUNK - 1) / GFX_DECODE_CHUNK;
+
+	if (nChunks > 1 && BurnThreadCount() > 1) {
+		BurnThreadRun(GfxDecodeChunk, nChunks, &job);
+	} else {
+		for (INT32 i = 0; i < nChunks; i++) {
+			GfxDecodeChunk(i, &job);
+		}
 	}
-}
 
-void Render8x8Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipXY called without init\n"));
-#endif
+	if (bPlan) GfxDecodePlanExit(&plan);
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_FLIPX(7, 0);
-		PLOTPIXEL_FLIPX(6, 1);
-		PLOTPIXEL_FLIPX(5, 2);
-		PLOTPIXEL_FLIPX(4, 3);
-		PLOTPIXEL_FLIPX(3, 4);
-		PLOTPIXEL_FLIPX(2, 5);
-		PLOTPIXEL_FLIPX(1, 6);
-		PLOTPIXEL_FLIPX(0, 7);
-	}
+	BurnProfileEnd();
 }
 
-void Render8x8Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+// the tables for the last layout used are kept, GfxDecodeSingle() is called a tile at a
+// time as the game writes its graphics
+static GfxDecodePlan SinglePlan;
+static INT32 *pSingleLayout = NULL;
+static INT32 nSingleLayoutLen = 0;
+static bool bSinglePlan = false;
+
+void GfxDecodeSingle(INT32 which, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipXY_Clip called without init\n"));
-#endif
+	INT32 nLen = 4 + numPlanes + xSize + ySize;
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+	if (pSingleLayout == NULL || nLen != nSingleLayoutLen || pSingleLayout[0] != numPlanes || pSingleLayout[1] != xSize || pSingleLayout[2] != ySize || pSingleLayout[3] != modulo ||
+		memcmp(pSingleLayout + 4, planeoffsets, numPlanes * sizeof(INT32)) ||
+		memcmp(pSingleLayout + 4 + numPlanes, xoffsets, xSize * sizeof(INT32)) ||
+		memcmp(pSingleLayout + 4 + numPlanes + xSize, yoffsets, ySize * sizeof(INT32)))
+	{
+		GfxDecodeSingleExit();
 
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
+		pSingleLayout = (INT32*)malloc(nLen * sizeof(INT32));
+		if (pSingleLayout) {
+			nSingleLayoutLen = nLen;
+			pSingleLayout[0] = numPlanes;
+			pSingleLayout[1] = xSize;
+			pSingleLayout[2] = ySize;
+			pSingleLayout[3] = modulo;
+			memcpy(pSingleLayout + 4, planeoffsets, numPlanes * sizeof(INT32));
+			memcpy(pSingleLayout + 4 + numPlanes, xoffsets, xSize * sizeof(INT32));
+			memcpy(pSingleLayout + 4 + numPlanes + xSize, yoffsets, ySize * sizeof(INT32));
 
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
+			bSinglePlan = (GfxDecodePlanInit(&SinglePlan, numPlanes, xSize, ySize, planeoffsets, xoffsets, yoffsets, modulo) == 0);
 		}
+	}
 
-		CLIPPIXEL(7, StartX, PLOTPIXEL_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_FLIPX(0, 7));
+	if (bSinglePlan) {
+		GfxDecodeTilePlan(&SinglePlan, which, xSize, ySize, yoffsets, modulo, pSrc, pDest);
+	} else {
+		GfxDecodeTileGeneric(which, numPlanes, xSize, ySize, planeoffsets, xoffsets, yoffsets, modulo, pSrc, pDest);
 	}
 }
 
+void GfxDecodeSingleExit()
+{
+	if (bSinglePlan) GfxDecodePlanExit(&SinglePlan);
+	bSinglePlan = false;
+
+	free(pSingleLayout);
+	pSingleLayout = NULL;
+	nSingleLayoutLen = 0;
+}
+
 /*================================================================================================
-8 x 8 Functions with Masking
+Lazy graphics decoding
 ================================================================================================*/
 
-void Render8x8Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask called without init\n"));
-#endif
+// The decoded region is calloc'd (the OS only backs the pages which get written) and a page of
+// tiles is decoded the first time one of them is drawn.  That always happens on the emulation
+// thread: GenericTilemapDraw() doesn't split a layer across the worker pool while a page is
+// still missing, and the pool only decodes pages inside GenericGfxLazyWarm(), which waits for
+// it before the pages are marked.  So the valid bits need no locking.
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK(0, nMaskColour);
-		PLOTPIXEL_MASK(1, nMaskColour);
-		PLOTPIXEL_MASK(2, nMaskColour);
-		PLOTPIXEL_MASK(3, nMaskColour);
-		PLOTPIXEL_MASK(4, nMaskColour);
-		PLOTPIXEL_MASK(5, nMaskColour);
-		PLOTPIXEL_MASK(6, nMaskColour);
-		PLOTPIXEL_MASK(7, nMaskColour);
-	}
-}
+#define GFX_LAZY_PAGE_TILES		64
+#define GFX_LAZY_WARM_PAGES		32		// most pages decoded by the pool per frame
 
-void Render8x8Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+struct GenericGfxLazy {
+	UINT8 *pSrc;
+	UINT8 *pDest;
+	INT32 nTiles, nPages, nPagesLeft;
+	INT32 numPlanes, xSize, ySize, modulo;
+	INT32 *pLayout;						// plane, x and y offsets
+	GfxDecodePlan plan;
+	bool bPlan;
+	UINT32 *pValid;						// a bit per page
+};
+
+static GenericGfxLazy *LazyGfx[MAX_GFX];
+static INT32 nLazyPagesLeft = 0;
+
+static inline INT32 GenericGfxLazyValid(GenericGfxLazy *lazy, INT32 nPage)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_Clip called without init\n"));
-#endif
+	return lazy->pValid[nPage >> 5] & (1U << (nPage & 31));
+}
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+static void GenericGfxLazyDecodePage(GenericGfxLazy *lazy, INT32 nPage)
+{
+	INT32 *planeoffsets = lazy->pLayout;
+	INT32 *xoffsets = planeoffsets + lazy->numPlanes;
+	INT32 *yoffsets = xoffsets + lazy->xSize;
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
+	INT32 nEnd = (nPage + 1) * GFX_LAZY_PAGE_TILES;
+	if (nEnd > lazy->nTiles) nEnd = lazy->nTiles;
 
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
+	for (INT32 c = nPage * GFX_LAZY_PAGE_TILES; c < nEnd; c++) {
+		if (lazy->bPlan) {
+			GfxDecodeTilePlan(&lazy->plan, c, lazy->xSize, lazy->ySize, yoffsets, lazy->modulo, lazy->pSrc, lazy->pDest);
+		} else {
+			GfxDecodeTileGeneric(c, lazy->numPlanes, lazy->xSize, lazy->ySize, planeoffsets, xoffsets, yoffsets, lazy->modulo, lazy->pSrc, lazy->pDest);
 		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK(7, nMaskColour));
 	}
 }
 
-void Render8x8Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+static void GenericGfxLazyMarkPage(GenericGfxLazy *lazy, INT32 nPage)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipX called without init\n"));
-#endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour);
-	}
+	lazy->pValid[nPage >> 5] |= 1U << (nPage & 31);
+	lazy->nPagesLeft--;
+	nLazyPagesLeft--;
 }
 
-void Render8x8Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+void GenericGfxLazyDecode(const GenericTilesGfx *gfx, UINT32 code)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipX_Clip called without init\n"));
-#endif
+	GenericGfxLazy *lazy = gfx->lazy;
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+	INT32 nPage = code / GFX_LAZY_PAGE_TILES;
+	if (nPage >= lazy->nPages || GenericGfxLazyValid(lazy, nPage)) return;
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
+	GenericGfxLazyDecodePage(lazy, nPage);
+	GenericGfxLazyMarkPage(lazy, nPage);
+}
 
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+void GenericGfxLazyDecodeAll(const GenericTilesGfx *gfx)
+{
+	GenericGfxLazy *lazy = gfx->lazy;
+	if (lazy == NULL) return;
 
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour));
+	for (INT32 nPage = 0; nPage < lazy->nPages && lazy->nPagesLeft; nPage++) {
+		if (GenericGfxLazyValid(lazy, nPage) == 0) {
+			GenericGfxLazyDecodePage(lazy, nPage);
+			GenericGfxLazyMarkPage(lazy, nPage);
+		}
 	}
 }
 
-void Render8x8Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+INT32 GenericGfxLazyPending()
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipY called without init\n"));
-#endif
+	return nLazyPagesLeft;
+}
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK(0, nMaskColour);
-		PLOTPIXEL_MASK(1, nMaskColour);
-		PLOTPIXEL_MASK(2, nMaskColour);
-		PLOTPIXEL_MASK(3, nMaskColour);
-		PLOTPIXEL_MASK(4, nMaskColour);
-		PLOTPIXEL_MASK(5, nMaskColour);
-		PLOTPIXEL_MASK(6, nMaskColour);
-		PLOTPIXEL_MASK(7, nMaskColour);
-	}
+struct GfxLazyWarmJob {
+	GenericGfxLazy *lazy[GFX_LAZY_WARM_PAGES];
+	INT32 nPage[GFX_LAZY_WARM_PAGES];
+};
+
+static void GenericGfxLazyWarmPage(INT32 nIndex, void *pParam)
+{
+	GfxLazyWarmJob *job = (GfxLazyWarmJob*)pParam;
+
+	GenericGfxLazyDecodePage(job->lazy[nIndex], job->nPage[nIndex]);
 }
 
-void Render8x8Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+// called once a frame (BurnTransferCopy), fills in a few of the missing pages on the pool
+static void GenericGfxLazyWarm()
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipY_Clip called without init\n"));
-#endif
+	INT32 nThreads = BurnThreadCount();
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+	if (nLazyPagesLeft == 0 || nThreads <= 1) return;
 
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
+	GfxLazyWarmJob job;
+	INT32 nJobs = 0;
+	INT32 nMax = nThreads * 2;
+	if (nMax > GFX_LAZY_WARM_PAGES) nMax = GFX_LAZY_WARM_PAGES;
 
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
+	for (INT32 i = 0; i < MAX_GFX && nJobs < nMax; i++) {
+		GenericGfxLazy *lazy = LazyGfx[i];
+		if (lazy == NULL || lazy->nPagesLeft == 0) continue;
+
+		for (INT32 nPage = 0; nPage < lazy->nPages && nJobs < nMax; nPage++) {
+			if (GenericGfxLazyValid(lazy, nPage) == 0) {
+				job.lazy[nJobs] = lazy;
+				job.nPage[nJobs] = nPage;
+				nJobs++;
+			}
 		}
+	}
 
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK(7, nMaskColour));
+	BurnThreadRun(GenericGfxLazyWarmPage, nJobs, &job);
+
+	for (INT32 i = 0; i < nJobs; i++) {
+		GenericGfxLazyMarkPage(job.lazy[i], job.nPage[i]);
 	}
 }
 
-void Render8x8Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+void GenericTilesSetGfxLazy(INT32 nNum, UINT8 *pSrc, INT32 nTiles, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT32 nColorOffset, UINT32 nColorMask)
 {
 #if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipXY called without init\n"));
+	if (nNum < 0 || nNum >= MAX_GFX || nTiles <= 0 || pSrc == NULL) {
+		bprintf(PRINT_ERROR, _T("GenericTilesSetGfxLazy(%d, pSrc, %d, ...) called with bad initializer(s)!\n"), nNum, nTiles);
+		return;
+	}
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour);
+	if (LazyGfx[nNum]) {
+		bprintf(PRINT_ERROR, _T("GenericTilesSetGfxLazy(%d, ...) called twice for the same region!\n"), nNum);
+		return;
 	}
-}
 
-void Render8x8Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipXY_Clip called without init\n"));
-#endif
+	GenericGfxLazy *lazy = (GenericGfxLazy*)calloc(1, sizeof(GenericGfxLazy));
+	if (lazy == NULL) return;
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
+	lazy->pSrc = pSrc;
+	lazy->nTiles = nTiles;
+	lazy->nPages = (nTiles + GFX_LAZY_PAGE_TILES - 1) / GFX_LAZY_PAGE_TILES;
+	lazy->nPagesLeft = lazy->nPages;
+	lazy->numPlanes = numPlanes;
+	lazy->xSize = xSize;
+	lazy->ySize = ySize;
+	lazy->modulo = modulo;
 
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
+	lazy->pLayout = (INT32*)malloc((numPlanes + xSize + ySize) * sizeof(INT32));
+	lazy->pValid = (UINT32*)calloc((lazy->nPages + 31) / 32, sizeof(UINT32));
 
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+	// calloc rather than BurnMalloc, which would touch (and so commit) every page
+	lazy->pDest = (UINT8*)calloc(nTiles, xSize * ySize);
 
-		CLIPPIXEL(7, StartX, PLOTPIXEL_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_MASK_FLIPX(0, 7, nMaskColour));
+	if (lazy->pLayout == NULL || lazy->pValid == NULL || lazy->pDest == NULL) {
+		bprintf(PRINT_ERROR, _T("GenericTilesSetGfxLazy(%d, ...) out of memory!\n"), nNum);
+		free(lazy->pDest);
+		free(lazy->pValid);
+		free(lazy->pLayout);
+		free(lazy);
+		return;
 	}
-}
 
-/*================================================================================================
-16 x 16 Functions
-================================================================================================*/
+	memcpy(lazy->pLayout, planeoffsets, numPlanes * sizeof(INT32));
+	memcpy(lazy->pLayout + numPlanes, xoffsets, xSize * sizeof(INT32));
+	memcpy(lazy->pLayout + numPlanes + xSize, yoffsets, ySize * sizeof(INT32));
 
-void Render16x16Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+	lazy->bPlan = (GfxDecodePlanInit(&lazy->plan, numPlanes, xSize, ySize, planeoffsets, xoffsets, yoffsets, modulo) == 0);
+
+	LazyGfx[nNum] = lazy;
+	nLazyPagesLeft += lazy->nPages;
+
+	GenericTilemapSetGfx(nNum, lazy->pDest, numPlanes, xSize, ySize, nTiles * xSize * ySize, nColorOffset, nColorMask);
+	GenericGfxData[nNum].lazy = lazy;
+}
+
+static void GenericGfxLazyExit()
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile called without init\n"));
-#endif
+	for (INT32 i = 0; i < MAX_GFX; i++) {
+		GenericGfxLazy *lazy = LazyGfx[i];
+		if (lazy == NULL) continue;
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
+		if (lazy->bPlan) GfxDecodePlanExit(&lazy->plan);
+		free(lazy->pDest);
+		free(lazy->pValid);
+		free(lazy->pLayout);
+		free(lazy);
+
+		LazyGfx[i] = NULL;
+		GenericGfxData[i].lazy = NULL;
 	}
+
+	nLazyPagesLeft = 0;
 }
 
-void Render16x16Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Clip called without init\n"));
-#endif
+//================================================================================================
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
+// All of the Render*Tile functions below are thin wrappers around RenderTile(), which gets
+// specialised for each combination of flipping, clipping, masking and priority. With SSE2 or
+// NEON the rows are drawn 8 pixels at a time (palette add, masked blend for the transparent
+// colour and for the priority map), what is left of a clipped or odd sized row is drawn one
+// pixel at a time.
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
+#define RT_FLIPX		(1 << 0)
+#define RT_FLIPY		(1 << 1)
+#define RT_CLIP			(1 << 2)
+#define RT_MASK			(1 << 3)
+#define RT_PRIO			(1 << 4)
+#define RT_TRANSMASK	(1 << 5)
 
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
+#if defined TILES_SSE2
+// 8 pixels, pSrc points at the 8 source pixels (they are reversed here for RT_FLIPX)
+template <INT32 nFlags>
+static inline void RenderTileRow8(UINT16 *pPixel, UINT8 *pPri, const UINT8 *pSrc, __m128i vPalette, __m128i vMask, __m128i vPriority, __m128i vPriMask)
+{
+	__m128i vPxl = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)pSrc), _mm_setzero_si128());
 
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
+	if (nFlags & RT_FLIPX) {
+		vPxl = _mm_shuffle_epi32(_mm_shufflehi_epi16(_mm_shufflelo_epi16(vPxl, 0x1b), 0x1b), 0x4e);
 	}
-}
 
-void Render16x16Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipX called without init\n"));
-#endif
+	__m128i vOut = _mm_add_epi16(vPxl, vPalette);
+	__m128i vPri = _mm_setzero_si128();
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_FLIPX(15,  0);
-		PLOTPIXEL_FLIPX(14,  1);
-		PLOTPIXEL_FLIPX(13,  2);
-		PLOTPIXEL_FLIPX(12,  3);
-		PLOTPIXEL_FLIPX(11,  4);
-		PLOTPIXEL_FLIPX(10,  5);
-		PLOTPIXEL_FLIPX( 9,  6);
-		PLOTPIXEL_FLIPX( 8,  7);
-		PLOTPIXEL_FLIPX( 7,  8);
-		PLOTPIXEL_FLIPX( 6,  9);
-		PLOTPIXEL_FLIPX( 5, 10);
-		PLOTPIXEL_FLIPX( 4, 11);
-		PLOTPIXEL_FLIPX( 3, 12);
-		PLOTPIXEL_FLIPX( 2, 13);
-		PLOTPIXEL_FLIPX( 1, 14);
-		PLOTPIXEL_FLIPX( 0, 15);
+	if (nFlags & RT_PRIO) {
+		vPri = _mm_loadl_epi64((const __m128i*)pPri);
+		vPri = _mm_or_si128(vPriority, _mm_and_si128(vPri, vPriMask));
 	}
-}
 
-void Render16x16Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipX_Clip called without init\n"));
-#endif
+	if (nFlags & RT_MASK) {
+		__m128i vSkip = _mm_cmpeq_epi16(vPxl, vMask);
+		INT32 nSkip = _mm_movemask_epi8(vSkip);
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
+		if (nSkip == 0xffff) return; // nothing to draw
 
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
+		if (nSkip) {
+			vOut = _mm_or_si128(_mm_and_si128(vSkip, _mm_loadu_si128((const __m128i*)pPixel)), _mm_andnot_si128(vSkip, vOut));
 
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
+			if (nFlags & RT_PRIO) {
+				__m128i vSkip8 = _mm_packs_epi16(vSkip, vSkip);
+				vPri = _mm_or_si128(_mm_and_si128(vSkip8, _mm_loadl_epi64((const __m128i*)pPri)), _mm_andnot_si128(vSkip8, vPri));
+			}
 		}
+	}
+
+	_mm_storeu_si128((__m128i*)pPixel, vOut);
 
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 15));
+	if (nFlags & RT_PRIO) {
+		_mm_storel_epi64((__m128i*)pPri, vPri);
 	}
 }
+#endif
 
-void Render16x16Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+#if defined TILES_NEON
+// same as the SSE2 version above
+template <INT32 nFlags>
+static inline void RenderTileRow8(UINT16 *pPixel, UINT8 *pPri, const UINT8 *pSrc, uint16x8_t vPalette, uint16x8_t vMask, uint8x8_t vPriority, uint8x8_t vPriMask)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipY called without init\n"));
-#endif
+	uint8x8_t vSrc = vld1_u8(pSrc);
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
+	if (nFlags & RT_FLIPX) {
+		vSrc = vrev64_u8(vSrc);
 	}
-}
 
-void Render16x16Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipY_Clip called without init\n"));
-#endif
+	uint16x8_t vPxl = vmovl_u8(vSrc);
+	uint16x8_t vOut = vaddq_u16(vPxl, vPalette);
+	uint8x8_t vPri = vdup_n_u8(0);
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
+	if (nFlags & RT_PRIO) {
+		vPri = vorr_u8(vPriority, vand_u8(vld1_u8(pPri), vPriMask));
+	}
 
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
+	if (nFlags & RT_MASK) {
+		uint16x8_t vSkip = vceqq_u16(vPxl, vMask);
+		uint8x8_t vSkip8 = vmovn_u16(vSkip);
+		UINT64 nSkip = vget_lane_u64(vreinterpret_u64_u8(vSkip8), 0);
 
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
+		if (nSkip == ~(UINT64)0) return; // nothing to draw
+
+		if (nSkip) {
+			vOut = vbslq_u16(vSkip, vld1q_u16(pPixel), vOut);
+
+			if (nFlags & RT_PRIO) {
+				vPri = vbsl_u8(vSkip8, vld1_u8(pPri), vPri);
+			}
 		}
+	}
+
+	vst1q_u16(pPixel, vOut);
 
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
+	if (nFlags & RT_PRIO) {
+		vst1_u8(pPri, vPri);
 	}
 }
+#endif
 
-void Render16x16Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+// dest pixels x0 .. x1 - 1 of one row, pSrc is the (unflipped) source row
+template <INT32 nFlags>
+static inline void RenderTileRow(UINT16 *pPixel, UINT8 *pPri, const UINT8 *pSrc, INT32 x0, INT32 x1, INT32 nWidth, UINT32 nPalette, INT32 nMaskColour, INT32 nPriority, UINT8 *pTransTable)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipXY called without init\n"));
-#endif
+	INT32 x = x0;
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_FLIPX(15,  0);
-		PLOTPIXEL_FLIPX(14,  1);
-		PLOTPIXEL_FLIPX(13,  2);
-		PLOTPIXEL_FLIPX(12,  3);
-		PLOTPIXEL_FLIPX(11,  4);
-		PLOTPIXEL_FLIPX(10,  5);
-		PLOTPIXEL_FLIPX( 9,  6);
-		PLOTPIXEL_FLIPX( 8,  7);
-		PLOTPIXEL_FLIPX( 7,  8);
-		PLOTPIXEL_FLIPX( 6,  9);
-		PLOTPIXEL_FLIPX( 5, 10);
-		PLOTPIXEL_FLIPX( 4, 11);
-		PLOTPIXEL_FLIPX( 3, 12);
-		PLOTPIXEL_FLIPX( 2, 13);
-		PLOTPIXEL_FLIPX( 1, 14);
-		PLOTPIXEL_FLIPX( 0, 15);
+#if defined TILES_SSE2
+	if ((nFlags & RT_TRANSMASK) == 0 && (x1 - x0) >= 8) {
+		__m128i vPalette = _mm_set1_epi16((INT16)nPalette);
+		__m128i vMask = _mm_set1_epi16((nMaskColour & ~0xff) ? -1 : nMaskColour); // -1 never matches a pixel
+		__m128i vPriority = _mm_set1_epi8((INT8)nPriority);
+		__m128i vPriMask = _mm_set1_epi8((INT8)GenericTilesPRIMASK);
+
+		for (; x + 8 <= x1; x += 8) {
+			RenderTileRow8<nFlags>(pPixel + x, pPri + x, pSrc + ((nFlags & RT_FLIPX) ? (nWidth - 8 - x) : x), vPalette, vMask, vPriority, vPriMask);
+		}
 	}
-}
+#elif defined TILES_NEON
+	if ((nFlags & RT_TRANSMASK) == 0 && (x1 - x0) >= 8) {
+		uint16x8_t vPalette = vdupq_n_u16((UINT16)nPalette);
+		uint16x8_t vMask = vdupq_n_u16((nMaskColour & ~0xff) ? 0xffff : nMaskColour); // 0xffff never matches a pixel
+		uint8x8_t vPriority = vdup_n_u8((UINT8)nPriority);
+		uint8x8_t vPriMask = vdup_n_u8(GenericTilesPRIMASK);
 
-void Render16x16Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipXY_Clip called without init\n"));
+		for (; x + 8 <= x1; x += 8) {
+			RenderTileRow8<nFlags>(pPixel + x, pPri + x, pSrc + ((nFlags & RT_FLIPX) ? (nWidth - 8 - x) : x), vPalette, vMask, vPriority, vPriMask);
+		}
+	}
 #endif
 
+	for (; x < x1; x++) {
+		UINT8 pxl = pSrc[(nFlags & RT_FLIPX) ? (nWidth - 1 - x) : x];
+
+		if ((nFlags & RT_MASK) && pxl == nMaskColour) continue;
+		if ((nFlags & RT_TRANSMASK) && pTransTable[pxl]) continue;
+
+		pPixel[x] = nPalette + pxl;
+
+		if (nFlags & RT_PRIO) {
+			pPri[x] = nPriority | (pPri[x] & GenericTilesPRIMASK);
+		}
+	}
+}
+
+// nSize is the width and height of the square tile sizes (8, 16, 32) so those get loops of a
+// fixed length, 0 for the custom sizes
+template <INT32 nFlags, INT32 nSize>
+static void RenderTile(UINT16 *pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTransTable, UINT8 *pTile)
+{
+	if (nSize) {
+		nWidth = nHeight = nSize;
+	}
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
+	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
+	INT32 x0 = 0;
+	INT32 x1 = nWidth;
+
+	if (nFlags & RT_CLIP) {
+		if (StartX < nScreenWidthMin) x0 = nScreenWidthMin - StartX;
+		if (StartX + nWidth > nScreenWidthMax) x1 = nScreenWidthMax - StartX;
+	}
 
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
+	for (INT32 y = 0; y < nHeight; y++, pTileData += nWidth) {
+		INT32 nRow = StartY + ((nFlags & RT_FLIPY) ? (nHeight - 1 - y) : y);
+
+		if ((nFlags & RT_CLIP) && (nRow < nScreenHeightMin || nRow >= nScreenHeightMax)) {
 			continue;
 		}
 
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 15));
+		UINT16 *pPixel = pDestDraw + (nRow * nScreenWidth) + StartX;
+		UINT8 *pPri = (nFlags & RT_PRIO) ? (pPrioDraw + (nRow * nScreenWidth) + StartX) : NULL;
+
+		RenderTileRow<nFlags>(pPixel, pPri, pTileData, x0, x1, nWidth, nPalette, nMaskColour, nPriority, pTransTable);
 	}
 }
 
+/*================================================================================================
+8 x 8 Functions
+================================================================================================*/
+
+void Render8x8Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile called without init\n"));
+#endif
+
+	RenderTile<0, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render8x8Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Clip called without init\n"));
+#endif
+
+	RenderTile<RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render8x8Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipX called without init\n"));
+#endif
+
+	RenderTile<RT_FLIPX, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render8x8Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipX_Clip called without init\n"));
+#endif
+
+	RenderTile<RT_FLIPX | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render8x8Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipY called without init\n"));
+#endif
+
+	RenderTile<RT_FLIPY, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render8x8Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipY_Clip called without init\n"));
+#endif
+
+	RenderTile<RT_FLIPY | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render8x8Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipXY called without init\n"));
+#endif
+
+	RenderTile<RT_FLIPX | RT_FLIPY, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render8x8Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_FlipXY_Clip called without init\n"));
+#endif
+
+	RenderTile<RT_FLIPX | RT_FLIPY | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+/*================================================================================================
+8 x 8 Functions with Masking
+================================================================================================*/
+
+void Render8x8Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask called without init\n"));
+#endif
+
+	RenderTile<RT_MASK, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render8x8Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_Clip called without init\n"));
+#endif
+
+	RenderTile<RT_MASK | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render8x8Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipX called without init\n"));
+#endif
+
+	RenderTile<RT_MASK | RT_FLIPX, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render8x8Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipX_Clip called without init\n"));
+#endif
+
+	RenderTile<RT_MASK | RT_FLIPX | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render8x8Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipY called without init\n"));
+#endif
+
+	RenderTile<RT_MASK | RT_FLIPY, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render8x8Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipY_Clip called without init\n"));
+#endif
+
+	RenderTile<RT_MASK | RT_FLIPY | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render8x8Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipXY called without init\n"));
+#endif
+
+	RenderTile<RT_MASK | RT_FLIPX | RT_FLIPY, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render8x8Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipXY_Clip called without init\n"));
+#endif
+
+	RenderTile<RT_MASK | RT_FLIPX | RT_FLIPY | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
+}
+
+/*================================================================================================
+16 x 16 Functions
+================================================================================================*/
+
+void Render16x16Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile called without init\n"));
+#endif
+
+	RenderTile<0, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render16x16Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Clip called without init\n"));
+#endif
+
+	RenderTile<RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render16x16Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipX called without init\n"));
+#endif
+
+	RenderTile<RT_FLIPX, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render16x16Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipX_Clip called without init\n"));
+#endif
+
+	RenderTile<RT_FLIPX | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render16x16Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipY called without init\n"));
+#endif
+
+	RenderTile<RT_FLIPY, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render16x16Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipY_Clip called without init\n"));
+#endif
+
+	RenderTile<RT_FLIPY | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render16x16Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipXY called without init\n"));
+#endif
+
+	RenderTile<RT_FLIPX | RT_FLIPY, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
+void Render16x16Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_FlipXY_Clip called without init\n"));
+#endif
+
+	RenderTile<RT_FLIPX | RT_FLIPY | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
+}
+
 /*================================================================================================
 16 x 16 Functions with Masking
 ================================================================================================*/
@@ -1062,29 +1191,7 @@ void Render16x16Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, IN
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-	}
+	RenderTile<RT_MASK, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render16x16Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1093,33 +1200,7 @@ void Render16x16Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 Start
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-	}
+	RenderTile<RT_MASK | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render16x16Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1128,29 +1209,7 @@ void Render16x16Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 Star
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipX called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour);
-	}
+	RenderTile<RT_MASK | RT_FLIPX, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render16x16Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1159,33 +1218,7 @@ void Render16x16Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour));
-	}
+	RenderTile<RT_MASK | RT_FLIPX | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render16x16Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1194,29 +1227,7 @@ void Render16x16Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 Star
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-	}
+	RenderTile<RT_MASK | RT_FLIPY, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render16x16Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1225,33 +1236,7 @@ void Render16x16Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-	}
+	RenderTile<RT_MASK | RT_FLIPY | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render16x16Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1260,29 +1245,7 @@ void Render16x16Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 Sta
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipXY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour);
-	}
+	RenderTile<RT_MASK | RT_FLIPX | RT_FLIPY, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render16x16Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1291,33 +1254,7 @@ void Render16x16Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 15, nMaskColour));
-	}
+	RenderTile<RT_MASK | RT_FLIPX | RT_FLIPY | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 /*================================================================================================
@@ -1330,45 +1267,7 @@ void Render32x32Tile(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 S
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
-		PLOTPIXEL(16);
-		PLOTPIXEL(17);
-		PLOTPIXEL(18);
-		PLOTPIXEL(19);
-		PLOTPIXEL(20);
-		PLOTPIXEL(21);
-		PLOTPIXEL(22);
-		PLOTPIXEL(23);
-		PLOTPIXEL(24);
-		PLOTPIXEL(25);
-		PLOTPIXEL(26);
-		PLOTPIXEL(27);
-		PLOTPIXEL(28);
-		PLOTPIXEL(29);
-		PLOTPIXEL(30);
-		PLOTPIXEL(31);
-	}
+	RenderTile<0, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render32x32Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1377,49 +1276,7 @@ void Render32x32Tile_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, IN
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL(31));
-	}
+	RenderTile<RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render32x32Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1428,45 +1285,7 @@ void Render32x32Tile_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, I
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipX called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_FLIPX(31,  0);
-		PLOTPIXEL_FLIPX(30,  1);
-		PLOTPIXEL_FLIPX(29,  2);
-		PLOTPIXEL_FLIPX(28,  3);
-		PLOTPIXEL_FLIPX(27,  4);
-		PLOTPIXEL_FLIPX(26,  5);
-		PLOTPIXEL_FLIPX(25,  6);
-		PLOTPIXEL_FLIPX(24,  7);
-		PLOTPIXEL_FLIPX(23,  8);
-		PLOTPIXEL_FLIPX(22,  9);
-		PLOTPIXEL_FLIPX(21, 10);
-		PLOTPIXEL_FLIPX(20, 11);
-		PLOTPIXEL_FLIPX(19, 12);
-		PLOTPIXEL_FLIPX(18, 13);
-		PLOTPIXEL_FLIPX(17, 14);
-		PLOTPIXEL_FLIPX(16, 15);
-		PLOTPIXEL_FLIPX(15, 16);
-		PLOTPIXEL_FLIPX(14, 17);
-		PLOTPIXEL_FLIPX(13, 18);
-		PLOTPIXEL_FLIPX(12, 19);
-		PLOTPIXEL_FLIPX(11, 20);
-		PLOTPIXEL_FLIPX(10, 21);
-		PLOTPIXEL_FLIPX( 9, 22);
-		PLOTPIXEL_FLIPX( 8, 23);
-		PLOTPIXEL_FLIPX( 7, 24);
-		PLOTPIXEL_FLIPX( 6, 25);
-		PLOTPIXEL_FLIPX( 5, 26);
-		PLOTPIXEL_FLIPX( 4, 27);
-		PLOTPIXEL_FLIPX( 3, 28);
-		PLOTPIXEL_FLIPX( 2, 29);
-		PLOTPIXEL_FLIPX( 1, 30);
-		PLOTPIXEL_FLIPX( 0, 31);
-	}
+	RenderTile<RT_FLIPX, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render32x32Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1475,49 +1294,7 @@ void Render32x32Tile_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 Star
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 31));
-	}
+	RenderTile<RT_FLIPX | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render32x32Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1526,45 +1303,7 @@ void Render32x32Tile_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, I
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL( 0);
-		PLOTPIXEL( 1);
-		PLOTPIXEL( 2);
-		PLOTPIXEL( 3);
-		PLOTPIXEL( 4);
-		PLOTPIXEL( 5);
-		PLOTPIXEL( 6);
-		PLOTPIXEL( 7);
-		PLOTPIXEL( 8);
-		PLOTPIXEL( 9);
-		PLOTPIXEL(10);
-		PLOTPIXEL(11);
-		PLOTPIXEL(12);
-		PLOTPIXEL(13);
-		PLOTPIXEL(14);
-		PLOTPIXEL(15);
-		PLOTPIXEL(16);
-		PLOTPIXEL(17);
-		PLOTPIXEL(18);
-		PLOTPIXEL(19);
-		PLOTPIXEL(20);
-		PLOTPIXEL(21);
-		PLOTPIXEL(22);
-		PLOTPIXEL(23);
-		PLOTPIXEL(24);
-		PLOTPIXEL(25);
-		PLOTPIXEL(26);
-		PLOTPIXEL(27);
-		PLOTPIXEL(28);
-		PLOTPIXEL(29);
-		PLOTPIXEL(30);
-		PLOTPIXEL(31);
-	}
+	RenderTile<RT_FLIPY, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render32x32Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1573,49 +1312,7 @@ void Render32x32Tile_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 Star
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL(31));
-	}
+	RenderTile<RT_FLIPY | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render32x32Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1624,45 +1321,7 @@ void Render32x32Tile_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipXY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_FLIPX(31,  0);
-		PLOTPIXEL_FLIPX(30,  1);
-		PLOTPIXEL_FLIPX(29,  2);
-		PLOTPIXEL_FLIPX(28,  3);
-		PLOTPIXEL_FLIPX(27,  4);
-		PLOTPIXEL_FLIPX(26,  5);
-		PLOTPIXEL_FLIPX(25,  6);
-		PLOTPIXEL_FLIPX(24,  7);
-		PLOTPIXEL_FLIPX(23,  8);
-		PLOTPIXEL_FLIPX(22,  9);
-		PLOTPIXEL_FLIPX(21, 10);
-		PLOTPIXEL_FLIPX(20, 11);
-		PLOTPIXEL_FLIPX(19, 12);
-		PLOTPIXEL_FLIPX(18, 13);
-		PLOTPIXEL_FLIPX(17, 14);
-		PLOTPIXEL_FLIPX(16, 15);
-		PLOTPIXEL_FLIPX(15, 16);
-		PLOTPIXEL_FLIPX(14, 17);
-		PLOTPIXEL_FLIPX(13, 18);
-		PLOTPIXEL_FLIPX(12, 19);
-		PLOTPIXEL_FLIPX(11, 20);
-		PLOTPIXEL_FLIPX(10, 21);
-		PLOTPIXEL_FLIPX( 9, 22);
-		PLOTPIXEL_FLIPX( 8, 23);
-		PLOTPIXEL_FLIPX( 7, 24);
-		PLOTPIXEL_FLIPX( 6, 25);
-		PLOTPIXEL_FLIPX( 5, 26);
-		PLOTPIXEL_FLIPX( 4, 27);
-		PLOTPIXEL_FLIPX( 3, 28);
-		PLOTPIXEL_FLIPX( 2, 29);
-		PLOTPIXEL_FLIPX( 1, 30);
-		PLOTPIXEL_FLIPX( 0, 31);
-	}
+	RenderTile<RT_FLIPX | RT_FLIPY, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render32x32Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1671,49 +1330,7 @@ void Render32x32Tile_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 Sta
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_FLIPX( 0, 31));
-	}
+	RenderTile<RT_FLIPX | RT_FLIPY | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 /*================================================================================================
@@ -1726,45 +1343,7 @@ void Render32x32Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, IN
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-		PLOTPIXEL_MASK(16, nMaskColour);
-		PLOTPIXEL_MASK(17, nMaskColour);
-		PLOTPIXEL_MASK(18, nMaskColour);
-		PLOTPIXEL_MASK(19, nMaskColour);
-		PLOTPIXEL_MASK(20, nMaskColour);
-		PLOTPIXEL_MASK(21, nMaskColour);
-		PLOTPIXEL_MASK(22, nMaskColour);
-		PLOTPIXEL_MASK(23, nMaskColour);
-		PLOTPIXEL_MASK(24, nMaskColour);
-		PLOTPIXEL_MASK(25, nMaskColour);
-		PLOTPIXEL_MASK(26, nMaskColour);
-		PLOTPIXEL_MASK(27, nMaskColour);
-		PLOTPIXEL_MASK(28, nMaskColour);
-		PLOTPIXEL_MASK(29, nMaskColour);
-		PLOTPIXEL_MASK(30, nMaskColour);
-		PLOTPIXEL_MASK(31, nMaskColour);
-	}
+	RenderTile<RT_MASK, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render32x32Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1773,49 +1352,7 @@ void Render32x32Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 Start
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK(31, nMaskColour));
-	}
+	RenderTile<RT_MASK | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render32x32Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1824,45 +1361,7 @@ void Render32x32Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 Star
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipX called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour);
-	}
+	RenderTile<RT_MASK | RT_FLIPX, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render32x32Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1871,49 +1370,7 @@ void Render32x32Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour));
-	}
+	RenderTile<RT_MASK | RT_FLIPX | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render32x32Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1922,45 +1379,7 @@ void Render32x32Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 Star
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK( 0, nMaskColour);
-		PLOTPIXEL_MASK( 1, nMaskColour);
-		PLOTPIXEL_MASK( 2, nMaskColour);
-		PLOTPIXEL_MASK( 3, nMaskColour);
-		PLOTPIXEL_MASK( 4, nMaskColour);
-		PLOTPIXEL_MASK( 5, nMaskColour);
-		PLOTPIXEL_MASK( 6, nMaskColour);
-		PLOTPIXEL_MASK( 7, nMaskColour);
-		PLOTPIXEL_MASK( 8, nMaskColour);
-		PLOTPIXEL_MASK( 9, nMaskColour);
-		PLOTPIXEL_MASK(10, nMaskColour);
-		PLOTPIXEL_MASK(11, nMaskColour);
-		PLOTPIXEL_MASK(12, nMaskColour);
-		PLOTPIXEL_MASK(13, nMaskColour);
-		PLOTPIXEL_MASK(14, nMaskColour);
-		PLOTPIXEL_MASK(15, nMaskColour);
-		PLOTPIXEL_MASK(16, nMaskColour);
-		PLOTPIXEL_MASK(17, nMaskColour);
-		PLOTPIXEL_MASK(18, nMaskColour);
-		PLOTPIXEL_MASK(19, nMaskColour);
-		PLOTPIXEL_MASK(20, nMaskColour);
-		PLOTPIXEL_MASK(21, nMaskColour);
-		PLOTPIXEL_MASK(22, nMaskColour);
-		PLOTPIXEL_MASK(23, nMaskColour);
-		PLOTPIXEL_MASK(24, nMaskColour);
-		PLOTPIXEL_MASK(25, nMaskColour);
-		PLOTPIXEL_MASK(26, nMaskColour);
-		PLOTPIXEL_MASK(27, nMaskColour);
-		PLOTPIXEL_MASK(28, nMaskColour);
-		PLOTPIXEL_MASK(29, nMaskColour);
-		PLOTPIXEL_MASK(30, nMaskColour);
-		PLOTPIXEL_MASK(31, nMaskColour);
-	}
+	RenderTile<RT_MASK | RT_FLIPY, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render32x32Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -1969,49 +1388,7 @@ void Render32x32Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK(31, nMaskColour));
-	}
+	RenderTile<RT_MASK | RT_FLIPY | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render32x32Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2020,45 +1397,7 @@ void Render32x32Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 Sta
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipXY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour);
-	}
+	RenderTile<RT_MASK | RT_FLIPX | RT_FLIPY, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void Render32x32Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2067,49 +1406,7 @@ void Render32x32Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_MASK_FLIPX( 0, 31, nMaskColour));
-	}
+	RenderTile<RT_MASK | RT_FLIPX | RT_FLIPY | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 /*================================================================================================
@@ -2122,16 +1419,7 @@ void RenderCustomTile(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTil
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL(x);
-		}
-	}
+	RenderTile<0, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 void RenderCustomTile_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2140,20 +1428,7 @@ void RenderCustomTile_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL(x));
-		}
-	}
+	RenderTile<RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 void RenderCustomTile_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2162,16 +1437,7 @@ void RenderCustomTile_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipX called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<RT_FLIPX, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 void RenderCustomTile_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2180,20 +1446,7 @@ void RenderCustomTile_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<RT_FLIPX | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 void RenderCustomTile_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2202,16 +1455,7 @@ void RenderCustomTile_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL(x);
-		}
-	}
+	RenderTile<RT_FLIPY, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 void RenderCustomTile_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2220,20 +1464,7 @@ void RenderCustomTile_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL(x));
-		}
-	}
+	RenderTile<RT_FLIPY | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 void RenderCustomTile_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2242,16 +1473,7 @@ void RenderCustomTile_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipXY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<RT_FLIPX | RT_FLIPY, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 void RenderCustomTile_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2260,20 +1482,7 @@ void RenderCustomTile_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<RT_FLIPX | RT_FLIPY | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, 0, NULL, pTile);
 }
 
 /*================================================================================================
@@ -2286,16 +1495,7 @@ void RenderCustomTile_Mask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK(x, nMaskColour);
-		}
-	}
+	RenderTile<RT_MASK, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void RenderCustomTile_Mask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2304,20 +1504,7 @@ void RenderCustomTile_Mask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_MASK(x, nMaskColour));
-		}
-	}
+	RenderTile<RT_MASK | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void RenderCustomTile_Mask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2326,16 +1513,7 @@ void RenderCustomTile_Mask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipX called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
+	RenderTile<RT_MASK | RT_FLIPX, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void RenderCustomTile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2344,20 +1522,7 @@ void RenderCustomTile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHe
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
-		}
-	}
+	RenderTile<RT_MASK | RT_FLIPX | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void RenderCustomTile_Mask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2366,16 +1531,7 @@ void RenderCustomTile_Mask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK(x, nMaskColour);
-		}
-	}
+	RenderTile<RT_MASK | RT_FLIPY, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void RenderCustomTile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2384,20 +1540,7 @@ void RenderCustomTile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHe
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_MASK(x, nMaskColour));
-		}
-	}
+	RenderTile<RT_MASK | RT_FLIPY | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void RenderCustomTile_Mask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2405,17 +1548,8 @@ void RenderCustomTile_Mask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight
 #if defined FBNEO_DEBUG
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipXY called without init\n"));
 #endif
-
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
+
+	RenderTile<RT_MASK | RT_FLIPX | RT_FLIPY, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
 void RenderCustomTile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, UINT8 *pTile)
@@ -2424,46 +1558,16 @@ void RenderCustomTile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nH
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
-		}
-	}
+	RenderTile<RT_MASK | RT_FLIPX | RT_FLIPY | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, 0, NULL, pTile);
 }
 
-
-
 void Render8x8Tile_Prio(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
 #if defined FBNEO_DEBUG
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO(0);
-		PLOTPIXEL_PRIO(1);
-		PLOTPIXEL_PRIO(2);
-		PLOTPIXEL_PRIO(3);
-		PLOTPIXEL_PRIO(4);
-		PLOTPIXEL_PRIO(5);
-		PLOTPIXEL_PRIO(6);
-		PLOTPIXEL_PRIO(7);
-	}
+	RenderTile<RT_PRIO, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render8x8Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2472,26 +1576,7 @@ void Render8x8Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO(7));
-	}
+	RenderTile<RT_PRIO | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render8x8Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2500,22 +1585,7 @@ void Render8x8Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipX called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_FLIPX(7, 0);
-		PLOTPIXEL_PRIO_FLIPX(6, 1);
-		PLOTPIXEL_PRIO_FLIPX(5, 2);
-		PLOTPIXEL_PRIO_FLIPX(4, 3);
-		PLOTPIXEL_PRIO_FLIPX(3, 4);
-		PLOTPIXEL_PRIO_FLIPX(2, 5);
-		PLOTPIXEL_PRIO_FLIPX(1, 6);
-		PLOTPIXEL_PRIO_FLIPX(0, 7);
-	}
+	RenderTile<RT_PRIO | RT_FLIPX, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render8x8Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2524,26 +1594,7 @@ void Render8x8Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 S
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_FLIPX(0, 7));
-	}
+	RenderTile<RT_PRIO | RT_FLIPX | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render8x8Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2552,22 +1603,7 @@ void Render8x8Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO(0);
-		PLOTPIXEL_PRIO(1);
-		PLOTPIXEL_PRIO(2);
-		PLOTPIXEL_PRIO(3);
-		PLOTPIXEL_PRIO(4);
-		PLOTPIXEL_PRIO(5);
-		PLOTPIXEL_PRIO(6);
-		PLOTPIXEL_PRIO(7);
-	}
+	RenderTile<RT_PRIO | RT_FLIPY, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render8x8Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2576,26 +1612,7 @@ void Render8x8Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 S
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO(0));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO(1));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO(2));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO(3));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO(4));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO(5));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO(6));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO(7));
-	}
+	RenderTile<RT_PRIO | RT_FLIPY | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render8x8Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2604,22 +1621,7 @@ void Render8x8Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 Start
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipXY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_FLIPX(7, 0);
-		PLOTPIXEL_PRIO_FLIPX(6, 1);
-		PLOTPIXEL_PRIO_FLIPX(5, 2);
-		PLOTPIXEL_PRIO_FLIPX(4, 3);
-		PLOTPIXEL_PRIO_FLIPX(3, 4);
-		PLOTPIXEL_PRIO_FLIPX(2, 5);
-		PLOTPIXEL_PRIO_FLIPX(1, 6);
-		PLOTPIXEL_PRIO_FLIPX(0, 7);
-	}
+	RenderTile<RT_PRIO | RT_FLIPX | RT_FLIPY, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render8x8Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2628,26 +1630,7 @@ void Render8x8Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw+ ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_FLIPX(7, 0));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_FLIPX(6, 1));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_FLIPX(5, 2));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_FLIPX(4, 3));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_FLIPX(3, 4));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_FLIPX(2, 5));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_FLIPX(1, 6));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_FLIPX(0, 7));
-	}
+	RenderTile<RT_PRIO | RT_FLIPX | RT_FLIPY | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 /*================================================================================================
@@ -2660,22 +1643,7 @@ void Render8x8Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK(0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(7, nMaskColour);
-	}
+	RenderTile<RT_PRIO | RT_MASK, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2684,26 +1652,7 @@ void Render8x8Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 St
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK(7, nMaskColour));
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2712,22 +1661,7 @@ void Render8x8Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 S
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipX called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour);
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2736,26 +1670,7 @@ void Render8x8Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, IN
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 8; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour));
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2764,22 +1679,7 @@ void Render8x8Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 S
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK(0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(7, nMaskColour);
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPY, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2788,26 +1688,7 @@ void Render8x8Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, IN
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK(0, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK(1, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK(2, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK(3, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK(4, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK(5, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK(6, nMaskColour));
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK(7, nMaskColour));
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPY | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2816,22 +1697,7 @@ void Render8x8Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipXY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour);
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX | RT_FLIPY, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render8x8Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2840,26 +1706,7 @@ void Render8x8Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, I
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 6);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 7) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 7) * nScreenWidth) + StartX;
-
-	for (INT32 y = 7; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 8) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(7, 0, nMaskColour));
-		CLIPPIXEL(6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(6, 1, nMaskColour));
-		CLIPPIXEL(5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(5, 2, nMaskColour));
-		CLIPPIXEL(4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(4, 3, nMaskColour));
-		CLIPPIXEL(3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(3, 4, nMaskColour));
-		CLIPPIXEL(2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(2, 5, nMaskColour));
-		CLIPPIXEL(1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(1, 6, nMaskColour));
-		CLIPPIXEL(0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(0, 7, nMaskColour));
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX | RT_FLIPY | RT_CLIP, 8>(pDestDraw, 8, 8, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 /*================================================================================================
@@ -2872,30 +1719,7 @@ void Render16x16Tile_Prio(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, IN
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-	}
+	RenderTile<RT_PRIO, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render16x16Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2904,34 +1728,7 @@ void Render16x16Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 Start
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-	}
+	RenderTile<RT_PRIO | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render16x16Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2940,30 +1737,7 @@ void Render16x16Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 Star
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipX called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_FLIPX(15,  0);
-		PLOTPIXEL_PRIO_FLIPX(14,  1);
-		PLOTPIXEL_PRIO_FLIPX(13,  2);
-		PLOTPIXEL_PRIO_FLIPX(12,  3);
-		PLOTPIXEL_PRIO_FLIPX(11,  4);
-		PLOTPIXEL_PRIO_FLIPX(10,  5);
-		PLOTPIXEL_PRIO_FLIPX( 9,  6);
-		PLOTPIXEL_PRIO_FLIPX( 8,  7);
-		PLOTPIXEL_PRIO_FLIPX( 7,  8);
-		PLOTPIXEL_PRIO_FLIPX( 6,  9);
-		PLOTPIXEL_PRIO_FLIPX( 5, 10);
-		PLOTPIXEL_PRIO_FLIPX( 4, 11);
-		PLOTPIXEL_PRIO_FLIPX( 3, 12);
-		PLOTPIXEL_PRIO_FLIPX( 2, 13);
-		PLOTPIXEL_PRIO_FLIPX( 1, 14);
-		PLOTPIXEL_PRIO_FLIPX( 0, 15);
-	}
+	RenderTile<RT_PRIO | RT_FLIPX, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render16x16Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -2972,34 +1746,7 @@ void Render16x16Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 15));
-	}
+	RenderTile<RT_PRIO | RT_FLIPX | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render16x16Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3008,30 +1755,7 @@ void Render16x16Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 Star
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-	}
+	RenderTile<RT_PRIO | RT_FLIPY, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render16x16Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3040,34 +1764,7 @@ void Render16x16Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-	}
+	RenderTile<RT_PRIO | RT_FLIPY | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render16x16Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3076,30 +1773,7 @@ void Render16x16Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 Sta
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipXY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_FLIPX(15,  0);
-		PLOTPIXEL_PRIO_FLIPX(14,  1);
-		PLOTPIXEL_PRIO_FLIPX(13,  2);
-		PLOTPIXEL_PRIO_FLIPX(12,  3);
-		PLOTPIXEL_PRIO_FLIPX(11,  4);
-		PLOTPIXEL_PRIO_FLIPX(10,  5);
-		PLOTPIXEL_PRIO_FLIPX( 9,  6);
-		PLOTPIXEL_PRIO_FLIPX( 8,  7);
-		PLOTPIXEL_PRIO_FLIPX( 7,  8);
-		PLOTPIXEL_PRIO_FLIPX( 6,  9);
-		PLOTPIXEL_PRIO_FLIPX( 5, 10);
-		PLOTPIXEL_PRIO_FLIPX( 4, 11);
-		PLOTPIXEL_PRIO_FLIPX( 3, 12);
-		PLOTPIXEL_PRIO_FLIPX( 2, 13);
-		PLOTPIXEL_PRIO_FLIPX( 1, 14);
-		PLOTPIXEL_PRIO_FLIPX( 0, 15);
-	}
+	RenderTile<RT_PRIO | RT_FLIPX | RT_FLIPY, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render16x16Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3108,34 +1782,7 @@ void Render16x16Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15,  0));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14,  1));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13,  2));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12,  3));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11,  4));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10,  5));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9,  6));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8,  7));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7,  8));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6,  9));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 10));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 11));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 12));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 13));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 14));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 15));
-	}
+	RenderTile<RT_PRIO | RT_FLIPX | RT_FLIPY | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 /*================================================================================================
@@ -3148,30 +1795,7 @@ void Render16x16Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 Start
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-	}
+	RenderTile<RT_PRIO | RT_MASK, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3180,34 +1804,7 @@ void Render16x16Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3216,30 +1813,7 @@ void Render16x16Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipX called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour);
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3248,34 +1822,7 @@ void Render16x16Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 16; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour));
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3284,30 +1831,7 @@ void Render16x16Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPY, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3316,34 +1840,7 @@ void Render16x16Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPY | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3352,30 +1849,7 @@ void Render16x16Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipXY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour);
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX | RT_FLIPY, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render16x16Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3384,34 +1858,7 @@ void Render16x16Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 8);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 15) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 15) * nScreenWidth) + StartX;
-
-	for (INT32 y = 15; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 16) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15,  0, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14,  1, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13,  2, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12,  3, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11,  4, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10,  5, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9,  6, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8,  7, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7,  8, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6,  9, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 10, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 11, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 12, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 13, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 14, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 15, nMaskColour));
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX | RT_FLIPY | RT_CLIP, 16>(pDestDraw, 16, 16, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 /*================================================================================================
@@ -3424,46 +1871,7 @@ void Render32x32Tile_Prio(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, IN
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-		PLOTPIXEL_PRIO(16);
-		PLOTPIXEL_PRIO(17);
-		PLOTPIXEL_PRIO(18);
-		PLOTPIXEL_PRIO(19);
-		PLOTPIXEL_PRIO(20);
-		PLOTPIXEL_PRIO(21);
-		PLOTPIXEL_PRIO(22);
-		PLOTPIXEL_PRIO(23);
-		PLOTPIXEL_PRIO(24);
-		PLOTPIXEL_PRIO(25);
-		PLOTPIXEL_PRIO(26);
-		PLOTPIXEL_PRIO(27);
-		PLOTPIXEL_PRIO(28);
-		PLOTPIXEL_PRIO(29);
-		PLOTPIXEL_PRIO(30);
-		PLOTPIXEL_PRIO(31);
-	}
+	RenderTile<RT_PRIO, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render32x32Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3472,50 +1880,7 @@ void Render32x32Tile_Prio_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 Start
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO(31));
-	}
+	RenderTile<RT_PRIO | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render32x32Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3524,46 +1889,7 @@ void Render32x32Tile_Prio_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 Star
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipX called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_FLIPX(31,  0);
-		PLOTPIXEL_PRIO_FLIPX(30,  1);
-		PLOTPIXEL_PRIO_FLIPX(29,  2);
-		PLOTPIXEL_PRIO_FLIPX(28,  3);
-		PLOTPIXEL_PRIO_FLIPX(27,  4);
-		PLOTPIXEL_PRIO_FLIPX(26,  5);
-		PLOTPIXEL_PRIO_FLIPX(25,  6);
-		PLOTPIXEL_PRIO_FLIPX(24,  7);
-		PLOTPIXEL_PRIO_FLIPX(23,  8);
-		PLOTPIXEL_PRIO_FLIPX(22,  9);
-		PLOTPIXEL_PRIO_FLIPX(21, 10);
-		PLOTPIXEL_PRIO_FLIPX(20, 11);
-		PLOTPIXEL_PRIO_FLIPX(19, 12);
-		PLOTPIXEL_PRIO_FLIPX(18, 13);
-		PLOTPIXEL_PRIO_FLIPX(17, 14);
-		PLOTPIXEL_PRIO_FLIPX(16, 15);
-		PLOTPIXEL_PRIO_FLIPX(15, 16);
-		PLOTPIXEL_PRIO_FLIPX(14, 17);
-		PLOTPIXEL_PRIO_FLIPX(13, 18);
-		PLOTPIXEL_PRIO_FLIPX(12, 19);
-		PLOTPIXEL_PRIO_FLIPX(11, 20);
-		PLOTPIXEL_PRIO_FLIPX(10, 21);
-		PLOTPIXEL_PRIO_FLIPX( 9, 22);
-		PLOTPIXEL_PRIO_FLIPX( 8, 23);
-		PLOTPIXEL_PRIO_FLIPX( 7, 24);
-		PLOTPIXEL_PRIO_FLIPX( 6, 25);
-		PLOTPIXEL_PRIO_FLIPX( 5, 26);
-		PLOTPIXEL_PRIO_FLIPX( 4, 27);
-		PLOTPIXEL_PRIO_FLIPX( 3, 28);
-		PLOTPIXEL_PRIO_FLIPX( 2, 29);
-		PLOTPIXEL_PRIO_FLIPX( 1, 30);
-		PLOTPIXEL_PRIO_FLIPX( 0, 31);
-	}
+	RenderTile<RT_PRIO | RT_FLIPX, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render32x32Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3572,50 +1898,7 @@ void Render32x32Tile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 31));
-	}
+	RenderTile<RT_PRIO | RT_FLIPX | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render32x32Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3624,46 +1907,7 @@ void Render32x32Tile_Prio_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 Star
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO( 0);
-		PLOTPIXEL_PRIO( 1);
-		PLOTPIXEL_PRIO( 2);
-		PLOTPIXEL_PRIO( 3);
-		PLOTPIXEL_PRIO( 4);
-		PLOTPIXEL_PRIO( 5);
-		PLOTPIXEL_PRIO( 6);
-		PLOTPIXEL_PRIO( 7);
-		PLOTPIXEL_PRIO( 8);
-		PLOTPIXEL_PRIO( 9);
-		PLOTPIXEL_PRIO(10);
-		PLOTPIXEL_PRIO(11);
-		PLOTPIXEL_PRIO(12);
-		PLOTPIXEL_PRIO(13);
-		PLOTPIXEL_PRIO(14);
-		PLOTPIXEL_PRIO(15);
-		PLOTPIXEL_PRIO(16);
-		PLOTPIXEL_PRIO(17);
-		PLOTPIXEL_PRIO(18);
-		PLOTPIXEL_PRIO(19);
-		PLOTPIXEL_PRIO(20);
-		PLOTPIXEL_PRIO(21);
-		PLOTPIXEL_PRIO(22);
-		PLOTPIXEL_PRIO(23);
-		PLOTPIXEL_PRIO(24);
-		PLOTPIXEL_PRIO(25);
-		PLOTPIXEL_PRIO(26);
-		PLOTPIXEL_PRIO(27);
-		PLOTPIXEL_PRIO(28);
-		PLOTPIXEL_PRIO(29);
-		PLOTPIXEL_PRIO(30);
-		PLOTPIXEL_PRIO(31);
-	}
+	RenderTile<RT_PRIO | RT_FLIPY, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render32x32Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3672,50 +1916,7 @@ void Render32x32Tile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO( 0));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO( 1));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO( 2));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO( 3));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO( 4));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO( 5));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO( 6));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO( 7));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO( 8));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO( 9));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO(10));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO(11));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO(12));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO(13));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO(14));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO(15));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO(16));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO(17));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO(18));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO(19));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO(20));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO(21));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO(22));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO(23));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO(24));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO(25));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO(26));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO(27));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO(28));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO(29));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO(30));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO(31));
-	}
+	RenderTile<RT_PRIO | RT_FLIPY | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render32x32Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3724,46 +1925,7 @@ void Render32x32Tile_Prio_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 Sta
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipXY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_FLIPX(31,  0);
-		PLOTPIXEL_PRIO_FLIPX(30,  1);
-		PLOTPIXEL_PRIO_FLIPX(29,  2);
-		PLOTPIXEL_PRIO_FLIPX(28,  3);
-		PLOTPIXEL_PRIO_FLIPX(27,  4);
-		PLOTPIXEL_PRIO_FLIPX(26,  5);
-		PLOTPIXEL_PRIO_FLIPX(25,  6);
-		PLOTPIXEL_PRIO_FLIPX(24,  7);
-		PLOTPIXEL_PRIO_FLIPX(23,  8);
-		PLOTPIXEL_PRIO_FLIPX(22,  9);
-		PLOTPIXEL_PRIO_FLIPX(21, 10);
-		PLOTPIXEL_PRIO_FLIPX(20, 11);
-		PLOTPIXEL_PRIO_FLIPX(19, 12);
-		PLOTPIXEL_PRIO_FLIPX(18, 13);
-		PLOTPIXEL_PRIO_FLIPX(17, 14);
-		PLOTPIXEL_PRIO_FLIPX(16, 15);
-		PLOTPIXEL_PRIO_FLIPX(15, 16);
-		PLOTPIXEL_PRIO_FLIPX(14, 17);
-		PLOTPIXEL_PRIO_FLIPX(13, 18);
-		PLOTPIXEL_PRIO_FLIPX(12, 19);
-		PLOTPIXEL_PRIO_FLIPX(11, 20);
-		PLOTPIXEL_PRIO_FLIPX(10, 21);
-		PLOTPIXEL_PRIO_FLIPX( 9, 22);
-		PLOTPIXEL_PRIO_FLIPX( 8, 23);
-		PLOTPIXEL_PRIO_FLIPX( 7, 24);
-		PLOTPIXEL_PRIO_FLIPX( 6, 25);
-		PLOTPIXEL_PRIO_FLIPX( 5, 26);
-		PLOTPIXEL_PRIO_FLIPX( 4, 27);
-		PLOTPIXEL_PRIO_FLIPX( 3, 28);
-		PLOTPIXEL_PRIO_FLIPX( 2, 29);
-		PLOTPIXEL_PRIO_FLIPX( 1, 30);
-		PLOTPIXEL_PRIO_FLIPX( 0, 31);
-	}
+	RenderTile<RT_PRIO | RT_FLIPX | RT_FLIPY, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render32x32Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3772,50 +1934,7 @@ void Render32x32Tile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_FLIPX(31,  0));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_FLIPX(30,  1));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_FLIPX(29,  2));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_FLIPX(28,  3));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_FLIPX(27,  4));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_FLIPX(26,  5));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_FLIPX(25,  6));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_FLIPX(24,  7));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_FLIPX(23,  8));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_FLIPX(22,  9));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_FLIPX(21, 10));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_FLIPX(20, 11));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_FLIPX(19, 12));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_FLIPX(18, 13));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_FLIPX(17, 14));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_FLIPX(16, 15));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_FLIPX(15, 16));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_FLIPX(14, 17));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_FLIPX(13, 18));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_FLIPX(12, 19));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_FLIPX(11, 20));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_FLIPX(10, 21));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_FLIPX( 9, 22));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_FLIPX( 8, 23));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_FLIPX( 7, 24));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_FLIPX( 6, 25));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_FLIPX( 5, 26));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_FLIPX( 4, 27));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_FLIPX( 3, 28));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_FLIPX( 2, 29));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_FLIPX( 1, 30));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_FLIPX( 0, 31));
-	}
+	RenderTile<RT_PRIO | RT_FLIPX | RT_FLIPY | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 /*================================================================================================
@@ -3828,46 +1947,7 @@ void Render32x32Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 Start
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(31, nMaskColour);
-	}
+	RenderTile<RT_PRIO | RT_MASK, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3876,50 +1956,7 @@ void Render32x32Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK(31, nMaskColour));
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3928,46 +1965,7 @@ void Render32x32Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipX called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour);
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -3976,50 +1974,7 @@ void Render32x32Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < 32; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour));
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4028,46 +1983,7 @@ void Render32x32Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK( 0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK( 9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK(31, nMaskColour);
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPY, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4076,50 +1992,7 @@ void Render32x32Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK( 0, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK( 1, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK( 2, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK( 3, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK( 4, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK( 5, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK( 6, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK( 7, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK( 8, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK( 9, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK(10, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK(11, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK(12, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK(13, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK(14, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK(15, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK(16, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK(17, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK(18, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK(19, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK(20, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK(21, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK(22, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK(23, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK(24, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK(25, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK(26, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK(27, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK(28, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK(29, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK(30, nMaskColour));
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK(31, nMaskColour));
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPY | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4128,46 +2001,7 @@ void Render32x32Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipXY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour);
-		PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour);
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX | RT_FLIPY, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void Render32x32Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4176,50 +2010,7 @@ void Render32x32Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber << 10);
-
-	UINT16* pPixel = pDestDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + 31) * nScreenWidthMax) + StartX;
-
-	for (INT32 y = 31; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += 32) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		CLIPPIXEL(31, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(31,  0, nMaskColour));
-		CLIPPIXEL(30, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(30,  1, nMaskColour));
-		CLIPPIXEL(29, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(29,  2, nMaskColour));
-		CLIPPIXEL(28, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(28,  3, nMaskColour));
-		CLIPPIXEL(27, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(27,  4, nMaskColour));
-		CLIPPIXEL(26, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(26,  5, nMaskColour));
-		CLIPPIXEL(25, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(25,  6, nMaskColour));
-		CLIPPIXEL(24, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(24,  7, nMaskColour));
-		CLIPPIXEL(23, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(23,  8, nMaskColour));
-		CLIPPIXEL(22, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(22,  9, nMaskColour));
-		CLIPPIXEL(21, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(21, 10, nMaskColour));
-		CLIPPIXEL(20, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(20, 11, nMaskColour));
-		CLIPPIXEL(19, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(19, 12, nMaskColour));
-		CLIPPIXEL(18, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(18, 13, nMaskColour));
-		CLIPPIXEL(17, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(17, 14, nMaskColour));
-		CLIPPIXEL(16, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(16, 15, nMaskColour));
-		CLIPPIXEL(15, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(15, 16, nMaskColour));
-		CLIPPIXEL(14, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(14, 17, nMaskColour));
-		CLIPPIXEL(13, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(13, 18, nMaskColour));
-		CLIPPIXEL(12, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(12, 19, nMaskColour));
-		CLIPPIXEL(11, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(11, 20, nMaskColour));
-		CLIPPIXEL(10, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(10, 21, nMaskColour));
-		CLIPPIXEL( 9, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 9, 22, nMaskColour));
-		CLIPPIXEL( 8, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 8, 23, nMaskColour));
-		CLIPPIXEL( 7, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 7, 24, nMaskColour));
-		CLIPPIXEL( 6, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 6, 25, nMaskColour));
-		CLIPPIXEL( 5, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 5, 26, nMaskColour));
-		CLIPPIXEL( 4, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 4, 27, nMaskColour));
-		CLIPPIXEL( 3, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 3, 28, nMaskColour));
-		CLIPPIXEL( 2, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 2, 29, nMaskColour));
-		CLIPPIXEL( 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 1, 30, nMaskColour));
-		CLIPPIXEL( 0, StartX, PLOTPIXEL_PRIO_MASK_FLIPX( 0, 31, nMaskColour));
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX | RT_FLIPY | RT_CLIP, 32>(pDestDraw, 32, 32, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 /*================================================================================================
@@ -4232,17 +2023,7 @@ void RenderCustomTile_Prio(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth ) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO(x);
-		}
-	}
+	RenderTile<RT_PRIO, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void RenderCustomTile_Prio_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4251,21 +2032,7 @@ void RenderCustomTile_Prio_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO(x));
-		}
-	}
+	RenderTile<RT_PRIO | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void RenderCustomTile_Prio_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4274,17 +2041,7 @@ void RenderCustomTile_Prio_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipX called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<RT_PRIO | RT_FLIPX, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void RenderCustomTile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4293,21 +2050,7 @@ void RenderCustomTile_Prio_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHe
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<RT_PRIO | RT_FLIPX | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void RenderCustomTile_Prio_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4316,17 +2059,7 @@ void RenderCustomTile_Prio_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO(x);
-		}
-	}
+	RenderTile<RT_PRIO | RT_FLIPY, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void RenderCustomTile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4335,21 +2068,7 @@ void RenderCustomTile_Prio_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHe
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO(x));
-		}
-	}
+	RenderTile<RT_PRIO | RT_FLIPY | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void RenderCustomTile_Prio_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4358,17 +2077,7 @@ void RenderCustomTile_Prio_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipXY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<RT_PRIO | RT_FLIPX | RT_FLIPY, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void RenderCustomTile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4377,21 +2086,7 @@ void RenderCustomTile_Prio_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nH
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<RT_PRIO | RT_FLIPX | RT_FLIPY | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 /*================================================================================================
@@ -4404,17 +2099,7 @@ void RenderCustomTile_Prio_Mask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK(x, nMaskColour);
-		}
-	}
+	RenderTile<RT_PRIO | RT_MASK, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4423,21 +2108,7 @@ void RenderCustomTile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHei
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_MASK(x, nMaskColour));
-		}
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4446,17 +2117,7 @@ void RenderCustomTile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHe
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4465,21 +2126,7 @@ void RenderCustomTile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
-		}
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4488,17 +2135,7 @@ void RenderCustomTile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHe
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK(x, nMaskColour);
-		}
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPY, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4507,21 +2144,7 @@ void RenderCustomTile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_MASK(x, nMaskColour));
-		}
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPY | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4530,17 +2153,7 @@ void RenderCustomTile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nH
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour);
-		}
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX | RT_FLIPY, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
 void RenderCustomTile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, INT32 nMaskColour, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4549,48 +2162,16 @@ void RenderCustomTile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_MASK_FLIPX(nWidth - x - 1, x, nMaskColour));
-		}
-	}
+	RenderTile<RT_PRIO | RT_MASK | RT_FLIPX | RT_FLIPY | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nMaskColour, nPaletteOffset, nPriority, NULL, pTile);
 }
 
-
-
-
-
-
-
-
-
 void RenderCustomTile_Prio_TransMask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
 {
 #if defined FBNEO_DEBUG
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK(x);
-		}
-	}
+	RenderTile<RT_PRIO | RT_TRANSMASK, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, pTransTable, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4599,21 +2180,7 @@ void RenderCustomTile_Prio_TransMask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_TRANSMASK(x));
-		}
-	}
+	RenderTile<RT_PRIO | RT_TRANSMASK | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, pTransTable, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4622,17 +2189,7 @@ void RenderCustomTile_Prio_TransMask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<RT_PRIO | RT_TRANSMASK | RT_FLIPX, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, pTransTable, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4641,21 +2198,7 @@ void RenderCustomTile_Prio_TransMask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + (StartY * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + (StartY * nScreenWidth) + StartX;
-
-	for (INT32 y = 0; y < nHeight; y++, pPixel += nScreenWidth, pPri += nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<RT_PRIO | RT_TRANSMASK | RT_FLIPX | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, pTransTable, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4664,17 +2207,7 @@ void RenderCustomTile_Prio_TransMask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK(x);
-		}
-	}
+	RenderTile<RT_PRIO | RT_TRANSMASK | RT_FLIPY, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, pTransTable, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4683,21 +2216,7 @@ void RenderCustomTile_Prio_TransMask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(x, StartX, PLOTPIXEL_PRIO_TRANSMASK(x));
-		}
-	}
+	RenderTile<RT_PRIO | RT_TRANSMASK | RT_FLIPY | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, pTransTable, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4706,17 +2225,7 @@ void RenderCustomTile_Prio_TransMask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		for (INT32 x = 0; x < nWidth; x++) {
-			PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x);
-		}
-	}
+	RenderTile<RT_PRIO | RT_TRANSMASK | RT_FLIPX | RT_FLIPY, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, pTransTable, pTile);
 }
 
 void RenderCustomTile_Prio_TransMask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32 nTileNumber, INT32 StartX, INT32 StartY, INT32 nTilePalette, INT32 nColourDepth, UINT8 *pTransTable, INT32 nPaletteOffset, INT32 nPriority, UINT8 *pTile)
@@ -4725,40 +2234,17 @@ void RenderCustomTile_Prio_TransMask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY_Clip called without init\n"));
 #endif
 
-	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
-	pTileData = pTile + (nTileNumber * nWidth * nHeight);
-
-	UINT16* pPixel = pDestDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-	UINT8 *pPri = pPrioDraw + ((StartY + nHeight - 1) * nScreenWidth) + StartX;
-
-	for (INT32 y = nHeight - 1; y >= 0; y--, pPixel -= nScreenWidth, pPri -= nScreenWidth, pTileData += nWidth) {
-		if ((StartY + y) < nScreenHeightMin || (StartY + y) >= nScreenHeightMax) {
-			continue;
-		}
-
-		for (INT32 x = 0; x < nWidth; x++) {
-			CLIPPIXEL(nWidth - x - 1, StartX, PLOTPIXEL_PRIO_TRANSMASK_FLIPX(nWidth - x - 1, x));
-		}
-	}
+	RenderTile<RT_PRIO | RT_TRANSMASK | RT_FLIPX | RT_FLIPY | RT_CLIP, 0>(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, 0, nPaletteOffset, nPriority, pTransTable, pTile);
 }
 
+#undef RT_FLIPX
+#undef RT_FLIPY
+#undef RT_CLIP
+#undef RT_MASK
+#undef RT_PRIO
+#undef RT_TRANSMASK
 
 
-#undef PLOTPIXEL_PRIO_TRANSMASK
-#undef PLOTPIXEL_PRIO_MASK_FLIPX
-#undef PLOTPIXEL_TRANSMASK
-#undef PLOTPIXEL_TRANSMASK_FLIPX
-
-#undef PLOTPIXEL
-#undef PLOTPIXEL_FLIPX
-#undef PLOTPIXEL_MASK
-#undef CLIPPIXEL
-
-#undef PLOTPIXEL_PRIO
-#undef PLOTPIXEL_PRIO_FLIPX
-#undef PLOTPIXEL_PRIO_MASK
-#undef PLOTPIXEL_PRIO_MASK_FLIPX
-
 /*================================================================================================
 Merged tile functions (flipping/clipping merged)
 ================================================================================================*/
@@ -5741,6 +3227,7 @@ void DrawGfxTile(INT32 nBitmap, INT32 nGfx, INT32 nTileNumber, INT32 nStartX, IN
 	}
 
 	GenericTilesGfx *gfx = &GenericGfxData[nGfx];
+	GenericGfxCheckTile(gfx, nTileNumber % gfx->code_mask);
 
 	DrawCustomTile(bitmap, gfx->width, gfx->height, nTileNumber % gfx->code_mask, nStartX, nStartY, nFlipx, nFlipy, nTilePalette & gfx->color_mask, gfx->depth, gfx->color_offset, gfx->gfxbase);
 
@@ -5767,6 +3254,7 @@ void DrawGfxMaskTile(INT32 nBitmap, INT32 nGfx, INT32 nTileNumber, INT32 nStartX
 	}
 
 	GenericTilesGfx *gfx = &GenericGfxData[nGfx];
+	GenericGfxCheckTile(gfx, nTileNumber % gfx->code_mask);
 
 	DrawCustomMaskTile(bitmap, gfx->width, gfx->height, nTileNumber % gfx->code_mask, nStartX, nStartY, nFlipx, nFlipy, nTilePalette & gfx->color_mask, gfx->depth, nMaskColor, gfx->color_offset, gfx->gfxbase);
 
@@ -5794,6 +3282,7 @@ void DrawGfxPrioTile(INT32 nBitmap, INT32 nGfx, INT32 nTileNumber, INT32 nStartX
 	}
 
 	GenericTilesGfx *gfx = &GenericGfxData[nGfx];
+	GenericGfxCheckTile(gfx, nTileNumber % gfx->code_mask);
 
 	DrawCustomPrioTile(bitmap, gfx->width, gfx->height, nTileNumber % gfx->code_mask, nStartX, nStartY, nFlipx, nFlipy, nTilePalette & gfx->color_mask, gfx->depth, gfx->color_offset, nPriority, gfx->gfxbase);
 
@@ -5822,6 +3311,7 @@ void DrawGfxPrioMaskTile(INT32 nBitmap, INT32 nGfx, INT32 nTileNumber, INT32 nSt
 	}
 
 	GenericTilesGfx *gfx = &GenericGfxData[nGfx];
+	GenericGfxCheckTile(gfx, nTileNumber % gfx->code_mask);
 
 	DrawCustomPrioMaskTile(bitmap, gfx->width, gfx->height, nTileNumber % gfx->code_mask, nStartX, nStartY, nFlipx, nFlipy, nTilePalette & gfx->color_mask, gfx->depth, nMaskColor, gfx->color_offset, nPriority, gfx->gfxbase);
 
@@ -5833,122 +3323,138 @@ void DrawGfxPrioMaskTile(INT32 nBitmap, INT32 nGfx, INT32 nTileNumber, INT32 nSt
 }
 
 /*================================================================================================
-Zoomed Tile Functions
+Zoomed sprite spans
 ================================================================================================*/
 
-void RenderZoomedTile(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy)
+INT32 GenericZoomSpanInit(GenericZoomSpan *span, INT32 sx, INT32 sy, INT32 dw, INT32 dh, INT32 dx, INT32 dy, INT32 flipx, INT32 flipy, INT32 minx, INT32 maxx, INT32 miny, INT32 maxy)
 {
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderZoomedTile called without init\n"));
-#endif
+	INT32 ex = sx + dw;
+	INT32 ey = sy + dh;
 
-	// Based on MAME sources for tile zooming
-	UINT8 *gfx_base = gfx + (code * width * height);
-	int dh = (zoomy * height + 0x8000) / 0x10000;
-	int dw = (zoomx * width + 0x8000) / 0x10000;
+	// whole sprite outside of the clip
+	if (sx >= maxx || sy >= maxy || ex <= minx || ey <= miny) return 0;
 
-	if (dw && dh)
-	{
-		int dx = (width * 0x10000) / dw;
-		int dy = (height * 0x10000) / dh;
-		int ex = sx + dw;
-		int ey = sy + dh;
-		int x_index_base = 0;
-		int y_index = 0;
-
-		if (fx) {
-			x_index_base = (dw - 1) * dx;
-			dx = -dx;
-		}
+	INT32 x_index = 0;
+	INT32 y_index = 0;
 
-		if (fy) {
-			y_index = (dh - 1) * dy;
-			dy = -dy;
-		}
+	if (flipx) {
+		x_index = (dw - 1) * dx;
+		dx = -dx;
+	}
 
-		for (INT32 y = sy; y < ey; y++)
-		{
-			UINT8 *src = gfx_base + (y_index / 0x10000) * width;
-			UINT16 *dst = dest + y * nScreenWidth;
+	if (flipy) {
+		y_index = (dh - 1) * dy;
+		dy = -dy;
+	}
 
-			if (y >= nScreenHeightMin && y < nScreenHeightMax)
-			{
-				for (INT32 x = sx, x_index = x_index_base; x < ex; x++)
-				{
-					if (x >= nScreenWidthMin && x < nScreenWidthMax) {
-						INT32 pxl = src[x_index>>16];
+	if (sx < minx) {
+		x_index += (minx - sx) * dx;
+		sx = minx;
+	}
 
-						if (pxl != t)
-							dst[x] = pxl + color;
-					}
+	if (sy < miny) {
+		y_index += (miny - sy) * dy;
+		sy = miny;
+	}
 
-					x_index += dx;
-				}
-			}
+	if (ex > maxx) ex = maxx;
+	if (ey > maxy) ey = maxy;
+	if (ex - sx > ZOOMSPAN_MAX_WIDTH) ex = sx + ZOOMSPAN_MAX_WIDTH;
 
-			y_index += dy;
-		}
+	if (ex <= sx || ey <= sy) return 0;
+
+	span->x0 = sx;
+	span->x1 = ex;
+	span->y0 = sy;
+	span->y1 = ey;
+	span->y_index = y_index;
+	span->dy = dy;
+
+	for (INT32 i = 0; i < ex - sx; i++, x_index += dx) {
+		span->xtab[i] = x_index >> 16;
 	}
+
+	return 1;
 }
 
-void RenderZoomedPrioTile(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy, INT32 priority)
-{
-#if defined FBNEO_DEBUG
-	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderZoomedPrioTile called without init\n"));
-#endif
+#define ZOOM_PRIO		(1 << 0)	// pri = priority
+#define ZOOM_PRIOMASK	(1 << 1)	// sprite priority, only draw if !(priority & (1 << pri)), pri = 0x1f
+#define ZOOM_TRANSTAB	(1 << 2)	// transparency from tab[pixel + color]
 
-	// Based on MAME sources for tile zooming
+// Based on MAME sources for tile zooming
+template <INT32 nMode>
+static void RenderZoomedCore(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy, UINT8 *tab, UINT32 color_offset, INT32 priority)
+{
 	UINT8 *gfx_base = gfx + (code * width * height);
-	int dh = (zoomy * height + 0x8000) / 0x10000;
-	int dw = (zoomx * width + 0x8000) / 0x10000;
+	INT32 dh = (zoomy * height + 0x8000) / 0x10000;
+	INT32 dw = (zoomx * width + 0x8000) / 0x10000;
 
-	if (dw && dh)
-	{
-		int dx = (width * 0x10000) / dw;
-		int dy = (height * 0x10000) / dh;
-		int ex = sx + dw;
-		int ey = sy + dh;
-		int x_index_base = 0;
-		int y_index = 0;
-
-		if (fx) {
-			x_index_base = (dw - 1) * dx;
-			dx = -dx;
-		}
+	if (dw == 0 || dh == 0) return;
 
-		if (fy) {
-			y_index = (dh - 1) * dy;
-			dy = -dy;
-		}
+	GenericZoomSpan span;
 
-		for (INT32 y = sy; y < ey; y++)
-		{
-			UINT8 *src = gfx_base + (y_index / 0x10000) * width;
-			UINT16 *dst = dest + y * nScreenWidth;
-			UINT8 *pri = pPrioDraw + y * nScreenWidth;
+	if (GenericZoomSpanInit(&span, sx, sy, dw, dh, (width * 0x10000) / dw, (height * 0x10000) / dh, fx, fy, nScreenWidthMin, nScreenWidthMax, nScreenHeightMin, nScreenHeightMax) == 0) {
+		return;
+	}
 
-			if (y >= nScreenHeightMin && y < nScreenHeightMax)
-			{
-				for (INT32 x = sx, x_index = x_index_base; x < ex; x++)
-				{
-					if (x >= nScreenWidthMin && x < nScreenWidthMax) {
-						INT32 pxl = src[x_index>>16];
+	if (nMode & ZOOM_PRIOMASK) priority |= 1 << 31;
 
-						if (pxl != t) {
-							dst[x] = pxl + color;
-							pri[x] = priority;
-						}
-					}
+	INT32 nWidth = span.x1 - span.x0;
 
-					x_index += dx;
-				}
+	for (INT32 y = span.y0, y_index = span.y_index; y < span.y1; y++, y_index += span.dy)
+	{
+		UINT8 *src = gfx_base + (y_index >> 16) * width;
+		UINT16 *dst = dest + y * nScreenWidth + span.x0;
+		UINT8 *pri = (nMode & (ZOOM_PRIO | ZOOM_PRIOMASK)) ? (pPrioDraw + y * nScreenWidth + span.x0) : NULL;
+
+		for (INT32 x = 0; x < nWidth; x++)
+		{
+			INT32 pxl = src[span.xtab[x]];
+
+			if (nMode & ZOOM_TRANSTAB) {
+				pxl += color;
+				if (tab[pxl] == t) continue;
+				pxl += color_offset;
+			} else {
+				if (pxl == t) continue;
+				pxl += color;
 			}
 
-			y_index += dy;
+			if (nMode & ZOOM_PRIOMASK) {
+				if ((priority & (1 << pri[x])) == 0) {
+					dst[x] = pxl;
+				}
+				pri[x] = 0x1f;
+			} else {
+				dst[x] = pxl;
+				if (nMode & ZOOM_PRIO) pri[x] = priority;
+			}
 		}
 	}
 }
 
+/*================================================================================================
+Zoomed Tile Functions
+================================================================================================*/
+
+void RenderZoomedTile(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderZoomedTile called without init\n"));
+#endif
+
+	RenderZoomedCore<0>(dest, gfx, code, color, t, sx, sy, fx, fy, width, height, zoomx, zoomy, NULL, 0, 0);
+}
+
+void RenderZoomedPrioTile(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy, INT32 priority)
+{
+#if defined FBNEO_DEBUG
+	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderZoomedPrioTile called without init\n"));
+#endif
+
+	RenderZoomedCore<ZOOM_PRIO>(dest, gfx, code, color, t, sx, sy, fx, fy, width, height, zoomx, zoomy, NULL, 0, priority);
+}
+
 /*================================================================================================
 Tile with Transparency Table Functions
 ================================================================================================*/
@@ -6071,60 +3577,7 @@ void RenderZoomedPrioSprite(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, I
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderZoomedPrioSprite called without init\n"));
 #endif
 
-	// Based on MAME sources for tile zooming
-	UINT8 *gfx_base = gfx + (code * width * height);
-	int dh = (zoomy * height + 0x8000) / 0x10000;
-	int dw = (zoomx * width + 0x8000) / 0x10000;
-
-	priority |= 1 << 31;
-
-	if (dw && dh)
-	{
-		int dx = (width * 0x10000) / dw;
-		int dy = (height * 0x10000) / dh;
-		int ex = sx + dw;
-		int ey = sy + dh;
-		int x_index_base = 0;
-		int y_index = 0;
-
-		if (fx) {
-			x_index_base = (dw - 1) * dx;
-			dx = -dx;
-		}
-
-		if (fy) {
-			y_index = (dh - 1) * dy;
-			dy = -dy;
-		}
-
-		for (INT32 y = sy; y < ey; y++)
-		{
-			UINT8 *src = gfx_base + (y_index / 0x10000) * width;
-			UINT16 *dst = dest + y * nScreenWidth;
-			UINT8 *pri = pPrioDraw + y * nScreenWidth;
-
-			if (y >= nScreenHeightMin && y < nScreenHeightMax)
-			{
-				for (INT32 x = sx, x_index = x_index_base; x < ex; x++)
-				{
-					if (x >= nScreenWidthMin && x < nScreenWidthMax) {
-						INT32 pxl = src[x_index>>16];
-
-						if (pxl != t) {
-							if ((priority & (1 << pri[x])) == 0) {
-								dst[x] = pxl + color;
-							}
-							pri[x] = 0x1f;
-						}
-					}
-
-					x_index += dx;
-				}
-			}
-
-			y_index += dy;
-		}
-	}
+	RenderZoomedCore<ZOOM_PRIOMASK>(dest, gfx, code, color, t, sx, sy, fx, fy, width, height, zoomx, zoomy, NULL, 0, priority);
 }
 
 
@@ -6175,60 +3628,7 @@ void RenderZoomedPrioTranstabSpriteOffset(UINT16 *dest, UINT8 *gfx, INT32 code,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderZoomedPrioSprite called without init\n"));
 #endif
 
-	// Based on MAME sources for tile zooming
-	UINT8 *gfx_base = gfx + (code * width * height);
-	int dh = (zoomy * height + 0x8000) / 0x10000;
-	int dw = (zoomx * width + 0x8000) / 0x10000;
-
-	priority |= 1 << 31;
-
-	if (dw && dh)
-	{
-		int dx = (width * 0x10000) / dw;
-		int dy = (height * 0x10000) / dh;
-		int ex = sx + dw;
-		int ey = sy + dh;
-		int x_index_base = 0;
-		int y_index = 0;
-
-		if (fx) {
-			x_index_base = (dw - 1) * dx;
-			dx = -dx;
-		}
-
-		if (fy) {
-			y_index = (dh - 1) * dy;
-			dy = -dy;
-		}
-
-		for (INT32 y = sy; y < ey; y++)
-		{
-			UINT8 *src = gfx_base + (y_index / 0x10000) * width;
-			UINT16 *dst = dest + y * nScreenWidth;
-			UINT8 *pri = pPrioDraw + y * nScreenWidth;
-
-			if (y >= nScreenHeightMin && y < nScreenHeightMax)
-			{
-				for (INT32 x = sx, x_index = x_index_base; x < ex; x++)
-				{
-					if (x >= nScreenWidthMin && x < nScreenWidthMax) {
-						INT32 pxl = src[x_index>>16] + color;
-
-						if (tab[pxl] != t) {
-							if ((priority & (1 << pri[x])) == 0) {
-								dst[x] = pxl + color_offset;
-							}
-							pri[x] = 0x1f;
-						}
-					}
-
-					x_index += dx;
-				}
-			}
-
-			y_index += dy;
-		}
-	}
+	RenderZoomedCore<ZOOM_PRIOMASK | ZOOM_TRANSTAB>(dest, gfx, code, color, t, sx, sy, fx, fy, width, height, zoomx, zoomy, tab, color_offset, priority);
 }
 
 void RenderZoomedPrioTranstabSprite(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy, UINT8 *tab, INT32 priority)
@@ -6236,3 +3636,6 @@ void RenderZoomedPrioTranstabSprite(UINT16 *dest, UINT8 *gfx, INT32 code, INT32
 	RenderZoomedPrioTranstabSpriteOffset(dest, gfx, code, color, t, sx, sy, fx, fy, width, height, zoomx, zoomy, tab, 0x00, priority);
 }
 
+#undef ZOOM_PRIO
+#undef ZOOM_PRIOMASK
+#undef ZOOM_TRANSTAB
@@ -13,11 +13,30 @@ struct GenericTilesGfx {
 	UINT32 code_mask;	// gfx_len / width / height
 	UINT32 color_offset;// is there a color offset for this graphics region?
 	UINT32 color_mask;	// mask the color added to the pixels
+	struct GenericGfxLazy *lazy;	// tiles still to be decoded (GenericTilesSetGfxLazy), else NULL
 };
 
 extern GenericTilesGfx GenericGfxData[];
 void GenericTilesSetGfx(INT32 nNum, UINT8 *GfxBase, INT32 nDepth, INT32 nTileWidth, INT32 nTileHeight, INT32 nGfxLen, UINT32 nColorOffset, UINT32 nColorMask);
 
+// Lazy graphics: like GfxDecode() + GenericTilesSetGfx(), but a tile is only decoded (with
+// the rest of its page of tiles) the first time it's drawn through the generic tile and
+// tilemap functions.  The region costs nothing at init and pages that are never drawn are
+// never backed by memory.  With nBurnThreads set, the worker pool decodes a few more pages
+// every BurnTransferCopy() until the region is complete.  pSrc has to stay valid until
+// GenericTilesExit(), the layout arrays are copied.  A driver which reads the decoded
+// tiles itself has to call GenericGfxCheckTile() first (or GenericGfxLazyDecodeAll()).
+void GenericTilesSetGfxLazy(INT32 nNum, UINT8 *pSrc, INT32 nTiles, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT32 nColorOffset, UINT32 nColorMask);
+void GenericGfxLazyDecode(const GenericTilesGfx *gfx, UINT32 code);
+void GenericGfxLazyDecodeAll(const GenericTilesGfx *gfx);
+INT32 GenericGfxLazyPending();	// pages not yet decoded, tiles can only be drawn on the emulation thread until it's 0
+
+// make sure tile code (already limited by code_mask) of gfx is decoded
+static inline void GenericGfxCheckTile(const GenericTilesGfx *gfx, UINT32 code)
+{
+	if (gfx->lazy) GenericGfxLazyDecode(gfx, code);
+}
+
 extern UINT8* pTileData;
 extern INT32 nScreenWidth, nScreenHeight;
 extern UINT8 GenericTilesPRIMASK;
@@ -37,6 +56,7 @@ INT32 GenericTilesExit();
 
 void GfxDecode(INT32 num, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest);
 void GfxDecodeSingle(INT32 which, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest);
+void GfxDecodeSingleExit();	// frees the layout tables kept by GfxDecodeSingle (done in GenericTilesExit)
 
 void GenericTilesSetClip(INT32 nMinx, INT32 nMaxx, INT32 nMiny, INT32 nMaxy);
 void GenericTilesGetClip(INT32 *nMinx, INT32 *nMaxx, INT32 *nMiny, INT32 *nMaxy);
@@ -45,6 +65,22 @@ void GenericTilesSetClipRaw(INT32 nMinx, INT32 nMaxx, INT32 nMiny, INT32 nMaxy);
 void GenericTilesClearClipRaw();
 void GenericTilesSetScanline(INT32 nScanline);
 
+// Zoomed sprite spans, shared by the zoomed sprite renderers
+// The dw x dh rectangle at sx, sy is clipped (or culled) once, and the source column of every
+// visible pixel goes in xtab, so the inner loop is a table lookup without any clip tests.
+#define ZOOMSPAN_MAX_WIDTH	2048
+
+struct GenericZoomSpan {
+	INT32 x0, x1;		// visible columns, x1 exclusive
+	INT32 y0, y1;		// visible rows, y1 exclusive
+	INT32 y_index;		// 16.16 source row at y0
+	INT32 dy;			// 16.16 source step per row
+	INT32 xtab[ZOOMSPAN_MAX_WIDTH];	// source column of x0 + n
+};
+
+// dx and dy are 16.16 source steps per pixel, clip is minx <= x < maxx, returns 0 if nothing is visible
+INT32 GenericZoomSpanInit(GenericZoomSpan *span, INT32 sx, INT32 sy, INT32 dw, INT32 dh, INT32 dx, INT32 dy, INT32 flipx, INT32 flipy, INT32 minx, INT32 maxx, INT32 miny, INT32 maxy);
+
 // Sprite priority handling is different than tile!
 void RenderPrioSprite(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 priority);
 void RenderZoomedPrioSprite(UINT16 *dest, UINT8 *gfx, INT32 code, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy, INT32 priority);
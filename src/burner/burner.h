@@ -210,6 +210,8 @@ INT32 ZipOpen(char* szZip);
 INT32 ZipClose();
 INT32 ZipGetList(struct ZipEntry** pList, INT32* pnListCount);
 INT32 ZipLoadFile(UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry);
+INT32 ZipLoadEntry(char* szZip, INT32 nEntry, UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 (*pCancel)());
+void ZipCacheClear();
 INT32 __cdecl ZipLoadOneFile(char* arcName, const char* fileName, void** Dest, INT32* pnWrote);
 
 // bzip.cpp
@@ -68,6 +68,10 @@ int DrvExit();
 int ProgressUpdateBurner(double dProgress, const TCHAR* pszText, bool bAbs);
 int AppError(TCHAR* szText, int bWarning);
 
+// bzip.cpp
+void BzipCatalogBegin();
+void BzipCatalogEnd();
+
 //run.cpp
 extern int RunMessageLoop();
 extern int RunReset();
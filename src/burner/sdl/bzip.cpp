@@ -1,39 +1,28 @@
 // Burner Zip module
 #include "burner.h"
+#include "burn_profile.h"
+
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <sys/stat.h>
+#include <dirent.h>
 
 int nBzipError = 0;                                                             // non-zero if there is a problem with the opened romset
 
 static TCHAR* szBzipName[BZIP_MAX] = { NULL, };                                 // Zip files to search through
 
-struct RomFind { int nState; int nZip; int nPos; };                             // State is non-zero if found. 1 = found totally okay.
+struct RomFind { int nState; int nZip; int nPos; unsigned int nCrc; };                             // State is non-zero if found. 1 = found totally okay.
 static struct RomFind* RomFind = NULL;
 static int              nRomCount = 0; static int nTotalSize = 0;
-static struct ZipEntry* List = NULL; static int nListCount = 0; // List of entries for current zip file
+static struct ZipEntry* List = NULL; static int nListCount = 0; // List of entries for current zip file (owned by the catalog)
 static int              nCurrentZip = -1;                       // Zip which is currently open
 
 
 StringSet BzipText;                                                                                     // Text which describes any problems with loading the zip
 StringSet BzipDetail;                                                                                   // Text which describes in detail any problems with loading the zip
 
-static void BzipListFree()
-{
-	if (List)
-	{
-		for (int i = 0; i < nListCount; i++)
-		{
-			if (List[i].szName)
-			{
-				free(List[i].szName);
-				List[i].szName = NULL;
-			}
-		}
-		free(List);
-		List = NULL;
-	}
-
-	nListCount = 0;
-}
-
 static char* GetFilenameA(char* szFull)
 {
 	int nLen = strlen(szFull);
@@ -105,11 +94,583 @@ static int RomArchiveExists(TCHAR* szName)
 	return ret;
 }
 
+// ----------------------------------------------------------------------------
+// Archive catalog
+//
+// The file list (name, length, crc) of every archive BzipOpen() looks at is kept in memory,
+// and in roms.cat next to roms.found, along with the size and modification time of the
+// archive, so an archive is only opened again once it has changed.  Each list is indexed
+// on crc and on file name for FindRomByCrc()/FindRomByName().  While all drivers are being
+// scanned the rom directories are also listed once, instead of probing every rom path for
+// every driver.
+
+#define CAT_MAGIC "FBNeo archive catalog 1\n"
+
+struct CatArchive {
+	char*            szPath;                                                       // archive file, with extension
+	long long        nSize;
+	long long        nTime;
+	bool             bSeen;                                                        // checked against the file this session
+	int              nCount;
+	struct ZipEntry* List;
+	int              nHashMask;
+	int*             pCrcHash;                                                     // entry + 1, 0 = free slot
+	int*             pNameHash;
+};
+
+struct CatDir { int nCount; char** szNames; int nHashMask; int* pHash; };
+
+static struct CatArchive** Catalog = NULL;
+static int                 nCatalogCount = 0;
+static int                 nCatalogAlloc = 0;
+static int*                pCatalogHash = NULL;                                 // path -> archive + 1
+static int                 nCatalogHashMask = 0;
+static bool                bCatalogLoaded = false;
+static bool                bCatalogDirty = false;
+static struct CatDir*      CatalogDirs = NULL;                                  // rom directory listings, only during a scan
+static struct CatArchive*  CurrentCat = NULL;                                   // archive List belongs to
+
+static unsigned int CatHashString(const char* szText)
+{
+	unsigned int h = 2166136261u;
+
+	for (; *szText; szText++)
+	{
+		h = (h ^ (unsigned char)tolower((unsigned char)*szText)) * 16777619u;
+	}
+
+	return h;
+}
+
+static unsigned int CatHashCrc(unsigned int nCrc)
+{
+	return nCrc * 2654435761u;
+}
+
+static int CatHashSize(int nCount)
+{
+	int nSize = 2;
+	while (nSize < nCount * 2)
+	{
+		nSize <<= 1;
+	}
+
+	return nSize;
+}
+
+static void CatArchiveFree(struct CatArchive* pCat)
+{
+	if (pCat->List)
+	{
+		for (int i = 0; i < pCat->nCount; i++)
+		{
+			free(pCat->List[i].szName);
+		}
+		free(pCat->List);
+	}
+	free(pCat->pCrcHash);
+	free(pCat->pNameHash);
+	free(pCat->szPath);
+	free(pCat);
+}
+
+// Build the crc and name indexes of an archive.  Entries go in in list order, so the
+// first match along a probe sequence is the first match in the list, as before
+static int CatArchiveIndex(struct CatArchive* pCat)
+{
+	int nSize = CatHashSize(pCat->nCount);
+
+	pCat->nHashMask = nSize - 1;
+	pCat->pCrcHash = (int*)calloc(nSize, sizeof(int));
+	pCat->pNameHash = (int*)calloc(nSize, sizeof(int));
+	if (pCat->pCrcHash == NULL || pCat->pNameHash == NULL)
+	{
+		return 1;
+	}
+
+	for (int i = 0; i < pCat->nCount; i++)
+	{
+		unsigned int h = CatHashCrc(pCat->List[i].nCrc);
+		while (pCat->pCrcHash[h & pCat->nHashMask])
+		{
+			h++;
+		}
+		pCat->pCrcHash[h & pCat->nHashMask] = i + 1;
+
+		if (pCat->List[i].szName)
+		{
+			h = CatHashString(GetFilenameA(pCat->List[i].szName));
+			while (pCat->pNameHash[h & pCat->nHashMask])
+			{
+				h++;
+			}
+			pCat->pNameHash[h & pCat->nHashMask] = i + 1;
+		}
+	}
+
+	return 0;
+}
+
+static struct CatArchive* CatalogFind(const char* szPath)
+{
+	if (pCatalogHash == NULL)
+	{
+		return NULL;
+	}
+
+	for (unsigned int h = CatHashString(szPath); pCatalogHash[h & nCatalogHashMask]; h++)
+	{
+		struct CatArchive* pCat = Catalog[pCatalogHash[h & nCatalogHashMask] - 1];
+		if (strcmp(pCat->szPath, szPath) == 0)
+		{
+			return pCat;
+		}
+	}
+
+	return NULL;
+}
+
+static int CatalogAdd(struct CatArchive* pCat)
+{
+	if (nCatalogCount == nCatalogAlloc)
+	{
+		int nAlloc = nCatalogAlloc ? nCatalogAlloc * 2 : 256;
+		struct CatArchive** pNew = (struct CatArchive**)realloc(Catalog, nAlloc * sizeof(struct CatArchive*));
+		int* pHash = (int*)calloc(nAlloc * 2, sizeof(int));
+		if (pNew == NULL || pHash == NULL)
+		{
+			if (pNew)
+			{
+				Catalog = pNew;
+			}
+			free(pHash);
+			return 1;
+		}
+
+		Catalog = pNew;
+		nCatalogAlloc = nAlloc;
+
+		free(pCatalogHash);
+		pCatalogHash = pHash;
+		nCatalogHashMask = nAlloc * 2 - 1;
+
+		for (int i = 0; i < nCatalogCount; i++)
+		{
+			unsigned int h = CatHashString(Catalog[i]->szPath);
+			while (pCatalogHash[h & nCatalogHashMask])
+			{
+				h++;
+			}
+			pCatalogHash[h & nCatalogHashMask] = i + 1;
+		}
+	}
+
+	unsigned int h = CatHashString(pCat->szPath);
+	while (pCatalogHash[h & nCatalogHashMask])
+	{
+		h++;
+	}
+	pCatalogHash[h & nCatalogHashMask] = nCatalogCount + 1;
+	Catalog[nCatalogCount++] = pCat;
+
+	return 0;
+}
+
+static void CatalogName(char* szName)
+{
+#if defined(BUILD_SDL2) && !defined(SDL_WINDOWS)
+	char* szPath = SDL_GetPrefPath("fbneo", "config");                           // ends in a separator
+
+	snprintf(szName, MAX_PATH, "%sroms.cat", szPath ? szPath : "");
+	SDL_free(szPath);
+#else
+	sprintf(szName, "fbneo.cat");
+#endif
+}
+
+static int CatalogReadInt(FILE* h, void* pData, int nSize)
+{
+	return fread(pData, nSize, 1, h) != 1;
+}
+
+static void CatalogLoad()
+{
+	char szName[MAX_PATH];
+	char szMagic[sizeof(CAT_MAGIC)];
+	FILE* h;
+
+	bCatalogLoaded = true;
+
+	CatalogName(szName);
+	if ((h = fopen(szName, "rb")) == NULL)
+	{
+		return;
+	}
+
+	if (fread(szMagic, sizeof(CAT_MAGIC) - 1, 1, h) != 1 || memcmp(szMagic, CAT_MAGIC, sizeof(CAT_MAGIC) - 1))
+	{
+		fclose(h);
+		return;
+	}
+
+	for (;;)
+	{
+		int nLen;
+		if (CatalogReadInt(h, &nLen, sizeof(nLen)))
+		{
+			break;                                                                   // end of the catalog
+		}
+
+		struct CatArchive* pCat = (struct CatArchive*)calloc(1, sizeof(struct CatArchive));
+		if (pCat == NULL)
+		{
+			break;
+		}
+
+		bool bOK = nLen > 0 && nLen < MAX_PATH && (pCat->szPath = (char*)calloc(nLen + 1, 1)) != NULL && fread(pCat->szPath, nLen, 1, h) == 1;
+		bOK = bOK && !CatalogReadInt(h, &pCat->nSize, sizeof(pCat->nSize)) && !CatalogReadInt(h, &pCat->nTime, sizeof(pCat->nTime));
+		bOK = bOK && !CatalogReadInt(h, &pCat->nCount, sizeof(pCat->nCount)) && pCat->nCount >= 0 && pCat->nCount < 0x10000;
+		bOK = bOK && (pCat->List = (struct ZipEntry*)calloc(pCat->nCount + 1, sizeof(struct ZipEntry))) != NULL;
+
+		for (int i = 0; bOK && i < pCat->nCount; i++)
+		{
+			bOK = !CatalogReadInt(h, &nLen, sizeof(nLen)) && nLen >= 0 && nLen < MAX_PATH;
+			if (bOK && nLen)
+			{
+				bOK = (pCat->List[i].szName = (char*)calloc(nLen + 1, 1)) != NULL && fread(pCat->List[i].szName, nLen, 1, h) == 1;
+			}
+			bOK = bOK && !CatalogReadInt(h, &pCat->List[i].nLen, sizeof(pCat->List[i].nLen)) && !CatalogReadInt(h, &pCat->List[i].nCrc, sizeof(pCat->List[i].nCrc));
+		}
+
+		if (!bOK || CatArchiveIndex(pCat) || CatalogFind(pCat->szPath) || CatalogAdd(pCat))
+		{
+			CatArchiveFree(pCat);
+			break;                                                                   // damaged, keep what was read so far
+		}
+	}
+
+	fclose(h);
+}
+
+// Write out the archives that were checked this session (so deleted ones drop out)
+static void CatalogSave()
+{
+	char szName[MAX_PATH];
+	FILE* h;
+
+	CatalogName(szName);
+	if ((h = fopen(szName, "wb")) == NULL)
+	{
+		return;
+	}
+
+	fwrite(CAT_MAGIC, sizeof(CAT_MAGIC) - 1, 1, h);
+
+	for (int c = 0; c < nCatalogCount; c++)
+	{
+		struct CatArchive* pCat = Catalog[c];
+		if (!pCat->bSeen)
+		{
+			continue;
+		}
+
+		int nLen = strlen(pCat->szPath);
+		fwrite(&nLen, sizeof(nLen), 1, h);
+		fwrite(pCat->szPath, nLen, 1, h);
+		fwrite(&pCat->nSize, sizeof(pCat->nSize), 1, h);
+		fwrite(&pCat->nTime, sizeof(pCat->nTime), 1, h);
+		fwrite(&pCat->nCount, sizeof(pCat->nCount), 1, h);
+
+		for (int i = 0; i < pCat->nCount; i++)
+		{
+			nLen = pCat->List[i].szName ? strlen(pCat->List[i].szName) : 0;
+			fwrite(&nLen, sizeof(nLen), 1, h);
+			fwrite(pCat->List[i].szName, nLen, 1, h);
+			fwrite(&pCat->List[i].nLen, sizeof(pCat->List[i].nLen), 1, h);
+			fwrite(&pCat->List[i].nCrc, sizeof(pCat->List[i].nCrc), 1, h);
+		}
+	}
+
+	fclose(h);
+
+	bCatalogDirty = false;
+}
+
+// The catalog entry for archive szName (without extension), reading the archive when
+// it isn't in the catalog yet or has changed since.  NULL if it can't be opened
+static struct CatArchive* CatalogGet(const char* szName)
+{
+	char szPath[MAX_PATH];
+	struct stat st;
+
+	if (!bCatalogLoaded)
+	{
+		CatalogLoad();
+	}
+
+	// same order as ZipOpen()
+	snprintf(szPath, MAX_PATH, "%s.zip", szName);
+	if (stat(szPath, &st))
+	{
+#ifdef INCLUDE_7Z_SUPPORT
+		snprintf(szPath, MAX_PATH, "%s.7z", szName);
+		if (stat(szPath, &st))
+#endif
+		{
+			return NULL;
+		}
+	}
+
+	struct CatArchive* pCat = CatalogFind(szPath);
+	if (pCat && pCat->nSize == (long long)st.st_size && pCat->nTime == (long long)st.st_mtime)
+	{
+		pCat->bSeen = true;
+		return pCat;
+	}
+
+	struct ZipEntry* pList = NULL;
+	int nCount = 0;
+
+	if (ZipOpen((char*)szName))
+	{
+		return NULL;
+	}
+	if (ZipGetList(&pList, &nCount))
+	{
+		ZipClose();
+		return NULL;
+	}
+	ZipClose();
+
+	if (pCat == NULL)
+	{
+		pCat = (struct CatArchive*)calloc(1, sizeof(struct CatArchive));
+		if (pCat == NULL || (pCat->szPath = strdup(szPath)) == NULL || CatalogAdd(pCat))
+		{
+			if (pCat)
+			{
+				free(pCat->szPath);
+				free(pCat);
+			}
+			for (int i = 0; i < nCount; i++)
+			{
+				free(pList[i].szName);
+			}
+			free(pList);
+			return NULL;
+		}
+	}
+	else
+	{
+		// changed since it was catalogued
+		for (int i = 0; i < pCat->nCount; i++)
+		{
+			free(pCat->List[i].szName);
+		}
+		free(pCat->List);
+		free(pCat->pCrcHash);
+		free(pCat->pNameHash);
+		pCat->pCrcHash = pCat->pNameHash = NULL;
+	}
+
+	pCat->nSize = st.st_size;
+	pCat->nTime = st.st_mtime;
+	pCat->List = pList;
+	pCat->nCount = nCount;
+	pCat->bSeen = true;
+
+	if (CatArchiveIndex(pCat))
+	{
+		// no index, the lookups fall back to searching the list
+		free(pCat->pCrcHash);
+		free(pCat->pNameHash);
+		pCat->pCrcHash = pCat->pNameHash = NULL;
+	}
+
+	bCatalogDirty = true;
+
+	return pCat;
+}
+
+static void CatDirFree(struct CatDir* pDir)
+{
+	for (int i = 0; i < pDir->nCount; i++)
+	{
+		free(pDir->szNames[i]);
+	}
+	free(pDir->szNames);
+	free(pDir->pHash);
+	memset(pDir, 0, sizeof(struct CatDir));
+}
+
+static void CatDirRead(struct CatDir* pDir, const char* szPath)
+{
+	DIR* d = opendir(szPath[0] ? szPath : ".");
+	struct dirent* e;
+	int nAlloc = 0;
+
+	if (d == NULL)
+	{
+		return;
+	}
+
+	while ((e = readdir(d)) != NULL)
+	{
+		if (pDir->nCount == nAlloc)
+		{
+			nAlloc = nAlloc ? nAlloc * 2 : 256;
+			char** pNew = (char**)realloc(pDir->szNames, nAlloc * sizeof(char*));
+			if (pNew == NULL)
+			{
+				break;
+			}
+			pDir->szNames = pNew;
+		}
+		if ((pDir->szNames[pDir->nCount] = strdup(e->d_name)) != NULL)
+		{
+			pDir->nCount++;
+		}
+	}
+	closedir(d);
+
+	int nSize = CatHashSize(pDir->nCount);
+	pDir->nHashMask = nSize - 1;
+	pDir->pHash = (int*)calloc(nSize, sizeof(int));
+
+	for (int i = 0; pDir->pHash && i < pDir->nCount; i++)
+	{
+		unsigned int h = CatHashString(pDir->szNames[i]);
+		while (pDir->pHash[h & pDir->nHashMask])
+		{
+			h++;
+		}
+		pDir->pHash[h & pDir->nHashMask] = i + 1;
+	}
+}
+
+static bool CatDirHas(struct CatDir* pDir, const char* szName)
+{
+	if (pDir->pHash == NULL)
+	{
+		return false;
+	}
+
+	for (unsigned int h = CatHashString(szName); pDir->pHash[h & pDir->nHashMask]; h++)
+	{
+		if (_tcsicmp(pDir->szNames[pDir->pHash[h & pDir->nHashMask] - 1], szName) == 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Does rom archive szName exist in rom path d
+static int RomArchiveExistsIn(int d, char* szName)
+{
+	if (CatalogDirs == NULL)
+	{
+		TCHAR szFullName[MAX_PATH];
+
+		_stprintf(szFullName, _T("%s%hs"), szAppRomPaths[d], szName);
+		return RomArchiveExists(szFullName);
+	}
+
+	// the listing matches case insensitively, so it finds whatever opening the file could;
+	// only its hits are checked on the file system, where the case may matter
+	char szFileName[MAX_PATH];
+	bool bListed = false;
+
+	snprintf(szFileName, MAX_PATH, "%s.zip", szName);
+	bListed = CatDirHas(&CatalogDirs[d], szFileName);
+
+#ifdef INCLUDE_7Z_SUPPORT
+	snprintf(szFileName, MAX_PATH, "%s.7z", szName);
+	bListed = bListed || CatDirHas(&CatalogDirs[d], szFileName);
+#endif
+
+	if (!bListed)
+	{
+		return 0;
+	}
+
+	TCHAR szFullName[MAX_PATH];
+
+	_stprintf(szFullName, _T("%s%hs"), szAppRomPaths[d], szName);
+	return RomArchiveExists(szFullName);
+}
+
+// Start of a scan through all drivers: list the rom directories once
+void BzipCatalogBegin()
+{
+	BzipCatalogEnd();
+
+	CatalogDirs = (struct CatDir*)calloc(DIRS_MAX, sizeof(struct CatDir));
+	if (CatalogDirs == NULL)
+	{
+		return;
+	}
+
+	for (int d = 0; d < DIRS_MAX; d++)
+	{
+		// the same directory is often listed more than once (empty paths)
+		for (int e = 0; e < d; e++)
+		{
+			if (strcmp(szAppRomPaths[e], szAppRomPaths[d]) == 0)
+			{
+				CatalogDirs[d] = CatalogDirs[e];
+				CatalogDirs[d].nCount = -1 - e;                                     // shared, not freed twice
+				break;
+			}
+		}
+		if (CatalogDirs[d].nCount == 0)
+		{
+			CatDirRead(&CatalogDirs[d], szAppRomPaths[d]);
+		}
+	}
+}
+
+// End of the scan: drop the listings and store the catalog
+void BzipCatalogEnd()
+{
+	if (CatalogDirs)
+	{
+		for (int d = 0; d < DIRS_MAX; d++)
+		{
+			if (CatalogDirs[d].nCount >= 0)
+			{
+				CatDirFree(&CatalogDirs[d]);
+			}
+		}
+		free(CatalogDirs);
+		CatalogDirs = NULL;
+	}
+
+	if (bCatalogDirty)
+	{
+		CatalogSave();
+	}
+}
+
 static int FindRomByName(TCHAR* szName)
 {
 	struct ZipEntry* pl;
 	int i;
 
+	if (CurrentCat && CurrentCat->pNameHash)
+	{
+		for (unsigned int h = CatHashString(szName); CurrentCat->pNameHash[h & CurrentCat->nHashMask]; h++)
+		{
+			i = CurrentCat->pNameHash[h & CurrentCat->nHashMask] - 1;
+			if (_tcsicmp(szName, GetFilenameA(List[i].szName)) == 0)
+			{
+				return i;
+			}
+		}
+		return -1;
+	}
+
 	// Find the rom named szName in the List
 	for (i = 0, pl = List; i < nListCount; i++, pl++)
 	{
@@ -130,6 +691,19 @@ static int FindRomByCrc(unsigned int nCrc)
 	struct ZipEntry* pl;
 	int i;
 
+	if (CurrentCat && CurrentCat->pCrcHash)
+	{
+		for (unsigned int h = CatHashCrc(nCrc); CurrentCat->pCrcHash[h & CurrentCat->nHashMask]; h++)
+		{
+			i = CurrentCat->pCrcHash[h & CurrentCat->nHashMask] - 1;
+			if (nCrc == List[i].nCrc)
+			{
+				return i;
+			}
+		}
+		return -1;
+	}
+
 	// Find the rom named szName in the List
 	for (i = 0, pl = List; i < nListCount; i++, pl++)
 	{
@@ -318,6 +892,272 @@ static int CheckRoms()
 	return 0;
 }
 
+// ----------------------------------------------------------------------------
+// Rom prefetch
+//
+// While the driver is loading its roms, the ones that follow the rom it just asked for are
+// inflated ahead of it on a few worker threads, each with an archive handle of its own (zlib
+// checks the crc of every entry as it is read).  BzipBurnLoadRom() then only has to copy a
+// finished rom into place, or waits for the one being inflated.  Only .zip archives are
+// prefetched, anything else (or a rom the prefetch failed on) goes through ZipLoadFile() as
+// before.
+//
+// The workers never run further ahead than the run of roms of the same type as the last one
+// requested, so a region the driver doesn't load (found in the decoded rom cache, a BIOS it
+// doesn't use) is never inflated, only the rom after the last one requested is.
+
+#define FETCH_MAX_THREADS	4
+#define FETCH_BUDGET		(128 << 20)                                                 // bytes of inflated roms held ahead of the driver
+
+enum { FETCH_NONE = 0, FETCH_QUEUED, FETCH_RUNNING, FETCH_DONE };
+
+struct RomFetch { int nState; int nType; int nZip; int nPos; int nLen; int nWrote; int nRet; unsigned char* pData; };
+static struct RomFetch* RomFetch = NULL;
+static char             szFetchZip[BZIP_MAX][MAX_PATH];                                 // archive names for ZipLoadEntry()
+
+static std::thread*            FetchThread[FETCH_MAX_THREADS];
+static int                     nFetchThreads = 0;
+static int                     nFetchCalls = 0;                                 // BzipBurnLoadRom() calls so far
+static int                     nFetchNext = 0;                                  // first rom the workers haven't looked at
+static int                     nFetchEnd = 0;                                   // and the end of the run they may fetch
+static int                     nFetchHeld = 0;                                  // bytes in running/finished buffers
+static std::atomic<bool>       bFetchQuit(false);
+static std::mutex              FetchMutex;
+static std::condition_variable FetchCond;                                       // a rom finished, buffer space was freed or a rom was requested
+
+// stops the inflates in flight when the archive is closed
+static INT32 BzipFetchCancelled()
+{
+	return bFetchQuit;
+}
+
+static void BzipFetchWorker()
+{
+	std::unique_lock<std::mutex> lock(FetchMutex);
+
+	while (!bFetchQuit)
+	{
+		// roms the driver already loaded itself are skipped
+		while (nFetchNext < nFetchEnd && RomFetch[nFetchNext].nState != FETCH_QUEUED)
+		{
+			nFetchNext++;
+		}
+		if (nFetchNext >= nFetchEnd)
+		{
+			FetchCond.wait(lock);
+			continue;
+		}
+
+		struct RomFetch* pf = &RomFetch[nFetchNext];
+
+		if (nFetchHeld > 0 && nFetchHeld + pf->nLen > FETCH_BUDGET)
+		{
+			FetchCond.wait(lock);
+			continue;
+		}
+
+		pf->nState = FETCH_RUNNING;
+		nFetchHeld += pf->nLen;
+		nFetchNext++;
+
+		lock.unlock();
+
+		int nWrote = 0;
+		int nRet = 1;
+		unsigned char* pData = (unsigned char*)malloc(pf->nLen);
+		if (pData)
+		{
+			nRet = ZipLoadEntry(szFetchZip[pf->nZip], pf->nPos, pData, pf->nLen, &nWrote, BzipFetchCancelled);
+		}
+
+		lock.lock();
+
+		pf->pData = pData;
+		pf->nWrote = nWrote;
+		pf->nRet = nRet;
+		pf->nState = FETCH_DONE;
+
+		FetchCond.notify_all();
+	}
+}
+
+// Plan the prefetch: every rom that can be read ahead, the workers are only let at them by
+// BzipFetchLoad()
+static void BzipFetchInit()
+{
+	unsigned int nCores = std::thread::hardware_concurrency();
+	bool bZip[BZIP_MAX];
+	int nCount = 0;
+
+	if (nCores < 2)
+	{
+		return;
+	}
+
+	RomFetch = (struct RomFetch*)malloc(nRomCount * sizeof(struct RomFetch));
+	if (RomFetch == NULL)
+	{
+		return;
+	}
+	memset(RomFetch, 0, nRomCount * sizeof(struct RomFetch));
+
+	for (int z = 0; z < BZIP_MAX; z++)
+	{
+		bZip[z] = false;
+		if (szBzipName[z])
+		{
+			TCHAR szFileName[MAX_PATH];
+
+			_stprintf(szFileName, _T("%s.zip"), szBzipName[z]);
+			bZip[z] = FileExists(szFileName);
+			TCHARToANSI(szBzipName[z], szFetchZip[z], MAX_PATH);
+		}
+	}
+
+	for (int i = 0; i < nRomCount; i++)
+	{
+		struct BurnRomInfo ri;
+
+		memset(&ri, 0, sizeof(ri));
+		BurnDrvGetRomInfo(&ri, i);
+		RomFetch[i].nType = ri.nType;
+
+		if (RomFind[i].nState != 1 || !bZip[RomFind[i].nZip] || ri.nType == 0 || ri.nLen <= 0 || (ri.nType & (BRF_OPT | BRF_NODUMP)))
+		{
+			continue;
+		}
+
+		RomFetch[i].nState = FETCH_QUEUED;
+		RomFetch[i].nZip = RomFind[i].nZip;
+		RomFetch[i].nPos = RomFind[i].nPos;
+		RomFetch[i].nLen = ri.nLen;
+		nCount++;
+	}
+
+	if (nCount < 2)
+	{
+		free(RomFetch);
+		RomFetch = NULL;
+	}
+}
+
+static void BzipFetchStart()
+{
+	unsigned int nThreads = std::thread::hardware_concurrency();
+	if (nThreads > FETCH_MAX_THREADS)
+	{
+		nThreads = FETCH_MAX_THREADS;
+	}
+
+	bFetchQuit = false;
+	for (unsigned int t = 0; t < nThreads; t++)
+	{
+		FetchThread[nFetchThreads++] = new std::thread(BzipFetchWorker);
+	}
+}
+
+static void BzipFetchExit()
+{
+	{
+		std::lock_guard<std::mutex> lock(FetchMutex);
+		bFetchQuit = true;
+	}
+	FetchCond.notify_all();
+
+	for (int t = 0; t < nFetchThreads; t++)
+	{
+		FetchThread[t]->join();
+		delete FetchThread[t];
+		FetchThread[t] = NULL;
+	}
+	nFetchThreads = 0;
+
+	if (RomFetch)
+	{
+		for (int i = 0; i < nRomCount; i++)
+		{
+			if (RomFetch[i].pData)
+			{
+				free(RomFetch[i].pData);
+			}
+		}
+		free(RomFetch);
+		RomFetch = NULL;
+	}
+
+	nFetchCalls = 0;
+	nFetchNext = 0;
+	nFetchEnd = 0;
+	nFetchHeld = 0;
+	bFetchQuit = false;
+}
+
+// Load rom i through the prefetch, returns 0 if it is in Dest.
+// On failure the caller loads it the usual way (which also reports any error)
+static int BzipFetchLoad(unsigned char* Dest, int* pnWrote, int i)
+{
+	if (RomFetch == NULL)
+	{
+		return 1;
+	}
+
+	// a single rom loaded after the emulation has started shouldn't pull in the whole set
+	if (++nFetchCalls == 2)
+	{
+		BzipFetchStart();
+	}
+
+	std::unique_lock<std::mutex> lock(FetchMutex);
+	struct RomFetch* pf = &RomFetch[i];
+
+	// let the workers at the roms following this one, up to the end of its region
+	nFetchNext = i + 1;
+	nFetchEnd = i + 1;
+	while (nFetchEnd < nRomCount && RomFetch[nFetchEnd].nType == pf->nType)
+	{
+		nFetchEnd++;
+	}
+	FetchCond.notify_all();
+
+	if (pf->nState == FETCH_QUEUED)
+	{
+		// no worker got to it yet, read it straight into place
+		pf->nState = FETCH_NONE;
+		lock.unlock();
+
+		return ZipLoadEntry(szFetchZip[pf->nZip], pf->nPos, Dest, pf->nLen, pnWrote, NULL);
+	}
+
+	FetchCond.wait(lock, [pf] { return pf->nState != FETCH_RUNNING; });
+
+	if (pf->nState != FETCH_DONE)
+	{
+		return 1;
+	}
+
+	int nRet = pf->nRet;
+	if (nRet == 0)
+	{
+		memcpy(Dest, pf->pData, pf->nWrote);
+		if (pnWrote)
+		{
+			*pnWrote = pf->nWrote;
+		}
+	}
+
+	if (pf->pData)
+	{
+		free(pf->pData);
+		pf->pData = NULL;
+	}
+	nFetchHeld -= pf->nLen;
+	pf->nState = FETCH_NONE;
+
+	FetchCond.notify_all();
+
+	return nRet;
+}
+
 // ----------------------------------------------------------------------------
 
 static int __cdecl BzipBurnLoadRom(unsigned char* Dest, int* pnWrote, int i)
@@ -390,12 +1230,25 @@ static int __cdecl BzipBurnLoadRom(unsigned char* Dest, int* pnWrote, int i)
 		return 1;
 	}
 
+	BurnProfileBegin("rom inflate");
+	nRet = BzipFetchLoad(Dest, pnWrote, i);
+	BurnProfileEnd();
+
+	if (nRet == 0)                                                                       // Already inflated by the prefetch
+	{
+		fprintf(stderr, "%s (OK)\n", szText);
+		return 0;
+	}
+
 	nWantZip = RomFind[i].nZip;                                                          // Which zip file it is in
 	if (nCurrentZip != nWantZip)                                                         // If we haven't got the right zip file currently open
 	{
 		ZipClose();
 		nCurrentZip = -1;
-		if (ZipOpen(TCHARToANSI(szBzipName[nWantZip], NULL, 0)))
+		BurnProfileBegin("archive open");
+		nRet = ZipOpen(TCHARToANSI(szBzipName[nWantZip], NULL, 0));
+		BurnProfileEnd();
+		if (nRet)
 		{
 			return 1;
 		}
@@ -403,7 +1256,11 @@ static int __cdecl BzipBurnLoadRom(unsigned char* Dest, int* pnWrote, int i)
 	}
 
 	// Read in file and return how many bytes we read
-	if (ZipLoadFile(Dest, ri.nLen, pnWrote, RomFind[i].nPos))
+	BurnProfileBegin("rom inflate");
+	nRet = ZipLoadFile(Dest, ri.nLen, pnWrote, RomFind[i].nPos);
+	BurnProfileEnd();
+
+	if (nRet != 0)
 	{
 		// Error loading from the zip file
 		TCHAR szTemp[128] = _T("");
@@ -417,6 +1274,18 @@ static int __cdecl BzipBurnLoadRom(unsigned char* Dest, int* pnWrote, int i)
 	return 0;
 }
 
+// The crc of the file found for rom i (which may not be the one the driver expects), the
+// decoded ROM cache is keyed on these so a bad dump never hands its data to the good set
+static unsigned int __cdecl BzipBurnRomCrc(int i)
+{
+	if (RomFind == NULL || i < 0 || i >= nRomCount || RomFind[i].nState == 0)
+	{
+		return 0;
+	}
+
+	return RomFind[i].nCrc;
+}
+
 // ----------------------------------------------------------------------------
 
 int BzipStatus()
@@ -501,7 +1370,7 @@ int BzipOpen(bool bootApp)
 
 			_stprintf(szFullName, _T("%s%hs"), szAppRomPaths[d], szName);
 
-			if (RomArchiveExists(szFullName))                  // Check existence of the rom zip/7z archive file
+			if (RomArchiveExistsIn(d, szName))                 // Check existence of the rom zip/7z archive file
 
 			{
 				bFound = true;
@@ -551,11 +1420,15 @@ int BzipOpen(bool bootApp)
 			continue;
 		}
 
-		if (ZipOpen(TCHARToANSI(szBzipName[z], NULL, 0)) == 0)                            // Open the rom zip file
+		BurnProfileBegin("archive open");
+		CurrentCat = CatalogGet(TCHARToANSI(szBzipName[z], NULL, 0));                      // Get the list of entries (from the catalog if unchanged)
+		BurnProfileEnd();
+		if (CurrentCat)
 		{
 			nCurrentZip = z;
 
-			ZipGetList(&List, &nListCount);                                                                        // Get the list of entries
+			List = CurrentCat->List;
+			nListCount = CurrentCat->nCount;
 
 			for (int i = 0; i < nRomCount; i++)
 			{
@@ -578,6 +1451,7 @@ int BzipOpen(bool bootApp)
 
 				RomFind[i].nZip = z;                                                                                      // Remember which zip file it is in
 				RomFind[i].nPos = nFind;
+				RomFind[i].nCrc = List[nFind].nCrc;                                                                         // What will actually be loaded
 				RomFind[i].nState = 1;                                                                                      // Set to found okay
 
 				BurnDrvGetRomInfo(&ri, i);                                                                                  // Get info about the rom
@@ -631,10 +1505,11 @@ int BzipOpen(bool bootApp)
 				}
 			}
 
-			BzipListFree();
+			List = NULL;
+			nListCount = 0;
+			CurrentCat = NULL;
 		}
 
-		ZipClose();                                                                                                                       // Close the last zip file if open
 		nCurrentZip = -1;
 	}
 
@@ -753,7 +1628,10 @@ int BzipOpen(bool bootApp)
 			}
 		}
 
+		BzipFetchInit();
+
 		BurnExtLoadRom = BzipBurnLoadRom;                                                                         // Okay to call our function to load each rom
+		BurnExtRomCrc = BzipBurnRomCrc;
 	}
 	else
 	{
@@ -796,10 +1674,14 @@ int BzipOpen(bool bootApp)
 
 int BzipClose()
 {
+	BzipFetchExit();
+
 	ZipClose();
+	ZipCacheClear();
 	nCurrentZip = -1;                                                                                                    // Close the last zip file if open
 
 	BurnExtLoadRom = NULL;                                                                                               // Can't call our function to load each rom anymore
+	BurnExtRomCrc = NULL;
 	nBzipError = 0;                                                                                                  // reset romset errors
 
 	if (RomFind)
@@ -85,6 +85,10 @@ int ConfigAppLoad()
 		VAR(nAudDSPModule[0]);
 		VAR(nInterpolation);
 		VAR(nFMInterpolation);
+		VAR(bBurnSampleStreaming);
+		VAR(nBurnADPCMCacheSize);
+		VAR(nBurnThreads);
+		VAR(bBurnProfileStartup);
 		VAR(EnableHiscores);
 		// Other
 		STR(szAppRomPaths[0]);
@@ -132,6 +136,9 @@ int ConfigAppLoad()
 		STR(szAppListsPath);
 		STR(szAppDatListsPath);
 		STR(szAppArchivesPath);
+		STR(szBurnCachePath);
+		VAR(bBurnCacheShare);
+		VAR(bBurnZipMapShare);
 	
 	
 #undef STR
@@ -202,6 +209,14 @@ int ConfigAppSave()
 	VAR(nInterpolation);
 	_ftprintf(f, _T("\n// The order of FM interpolation\n"));
 	VAR(nFMInterpolation);
+	_ftprintf(f, _T("\n// If non-zero, keep samples as loaded and convert them as they play (less memory)\n"));
+	VAR(bBurnSampleStreaming);
+	_ftprintf(f, _T("\n// Size in KB of the pre-decoded ADPCM sample cache (MSM6295, YM2610), 0 = off\n"));
+	VAR(nBurnADPCMCacheSize);
+	_ftprintf(f, _T("\n// Number of threads for the parallel renderers (0 or 1 = off)\n"));
+	VAR(nBurnThreads);
+	_ftprintf(f, _T("\n// If non-zero, print where the time goes while starting a game\n"));
+	VAR(bBurnProfileStartup);
 	_ftprintf(f, _T("\n// If non-zero, enable high score saving support.\n"));
 	VAR(EnableHiscores);
 
@@ -276,6 +291,12 @@ int ConfigAppSave()
 	STR(szAppDatListsPath);
 	fprintf(f, "\n// UNUSED CURRENTLY (include trailing slash)\n");
 	STR(szAppArchivesPath);
+	fprintf(f, "\n// Decoded ROM cache path, speeds up starting big sets (leave empty to disable)\n");
+	STR(szBurnCachePath);
+	fprintf(f, "\n// If non-zero, map cache entries so instances running the same set share their memory\n");
+	VAR(bBurnCacheShare);
+	fprintf(f, "\n// If non-zero, map uncompressed romset entries in place (the romsets must not be replaced while a game runs)\n");
+	VAR(bBurnZipMapShare);
 	fprintf(f, "\n\n\n");
 
 #undef STR
@@ -1,6 +1,7 @@
 // Driver Init module
 #include "burner.h"
 #include "neocdlist.h"
+#include "burn_profile.h"
 int bDrvOkay = 0;                       // 1 if the Driver has been initted okay, and it's okay to use the BurnDrv functions
 
 char szAppRomPaths[DIRS_MAX][MAX_PATH] = { { "/usr/local/share/roms/" }, { "roms/" }, };
@@ -31,6 +32,7 @@ static int DoLibInit()                  // Do Init of Burn library driver
 {
 	int nRet;
 
+	BurnProfileStart(BurnDrvGetTextA(DRV_NAME));                                    // the report covers the archive scan as well
 	BzipOpen(false);
 
 	//ProgressCreate();
@@ -38,6 +40,7 @@ static int DoLibInit()                  // Do Init of Burn library driver
 	nRet = BurnDrvInit();
 
 	BzipClose();
+	BurnProfileStop();
 
 	//ProgressDestroy();
 
@@ -22,7 +22,7 @@ int  nAppVirtualFps = 0;         // App fps * 100
 bool bRunPause = 0;
 bool bAppFullscreen = 0;
 bool bAlwaysProcessKeyboardInput = 0;
-int  usemenu = 0, usejoy = 1, vsync = 1, dat = 0;
+int  usemenu = 0, usejoy = 1, vsync = 1, audiosync = 0, dat = 0;
 bool bSaveconfig = 1;
 bool bIntegerScale = false;
 
@@ -65,6 +65,11 @@ int parseSwitches(int argc, char* argv[])
 			set_commandline_option(vsync, 0)
 		}
 
+		if (strcmp(argv[i] + 1, "audiosync") == 0)
+		{
+			set_commandline_option(audiosync, 1)
+		}
+
 		if (strcmp(argv[i] + 1, "integerscale") == 0)
 		{
 			set_commandline_option(bIntegerScale, 1)
@@ -310,7 +315,7 @@ int main(int argc, char* argv[])
 
 	if (romname == NULL)
 	{
-		printf("Usage: %s [-cd] [-joy] [-menu] [-novsync] [-integerscale] [-fullscreen] [-dat] [-autosave] [-nearest] [-linear] [-best] <romname>\n", argv[0]);
+		printf("Usage: %s [-cd] [-joy] [-menu] [-novsync] [-audiosync] [-integerscale] [-fullscreen] [-dat] [-autosave] [-nearest] [-linear] [-best] <romname>\n", argv[0]);
 		printf("Note the -menu switch does not require a romname\n");
 		printf("e.g.: %s mslug\n", argv[0]);
 		printf("e.g.: %s -menu -joy\n", argv[0]);
@@ -670,6 +670,8 @@ void RefreshRomList(bool force_rescan)
 		return;
 	}
 
+	BzipCatalogBegin();
+
 	for (INT32 i = 0; i < nBurnDrvCount; i++)
 	{
 		nBurnDrvActive = i;
@@ -708,6 +710,7 @@ void RefreshRomList(bool force_rescan)
 			SDL_PollEvent(&e); // poll some events so OS doesn't think it's crashed
 		}
 	}
+	BzipCatalogEnd();
 	WriteGameAvb();
 	nBurnDrvActive = tempgame;
 }
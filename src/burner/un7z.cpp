@@ -194,6 +194,9 @@ void FileOutStream_CreateVTable(CFileOutStream *p)
 /* number of open files to cache */
 #define _7Z_CACHE_SIZE	8
 
+/* decoded solid blocks kept across all archives (one block is always kept, however big) */
+#define _7Z_BLOCK_BUDGET	(256 * 1024 * 1024)
+
 
 /***************************************************************************
     GLOBAL VARIABLES
@@ -201,6 +204,10 @@ void FileOutStream_CreateVTable(CFileOutStream *p)
 
 static _7z_file *_7z_cache[_7Z_CACHE_SIZE];
 
+static _7z_file *_7z_live = NULL;			/* all archives holding decoded blocks */
+static size_t _7z_block_bytes = 0;
+static UINT32 _7z_block_clock = 0;
+
 /***************************************************************************
     FUNCTION PROTOTYPES
 ***************************************************************************/
@@ -383,10 +390,6 @@ _7z_error _7z_file_open(const char *filename, _7z_file **_7z)
 		goto error;
 	}
 
-	new_7z->blockIndex = 0xFFFFFFFF; /* it can have any value before first call (if outBuffer = 0) */
-	new_7z->outBuffer = 0; /* it must be 0 before first call for each new archive. */
-	new_7z->outBufferSize = 0;  /* it can have any value before first call (if outBuffer = 0) */
-
 	/* make a copy of the filename for caching purposes */
 	string = (char *)malloc(strlen(filename) + 1);
 	if (string == NULL)
@@ -396,6 +399,10 @@ _7z_error _7z_file_open(const char *filename, _7z_file **_7z)
 	}
 	strcpy(string, filename);
 	new_7z->filename = string;
+
+	new_7z->next_live = _7z_live;
+	_7z_live = new_7z;
+
 	*_7z = new_7z;
 	return _7ZERR_NONE;
 
@@ -459,6 +466,72 @@ void _7z_file_cache_clear(void)
     from a _7Z into the target buffer
 -------------------------------------------------*/
 
+static void _7z_block_free(_7z_file *_7z, _7z_block *block)
+{
+	if (block->outBuffer)
+	{
+		IAlloc_Free(&_7z->allocImp, block->outBuffer);
+		_7z_block_bytes -= block->outBufferSize;
+	}
+	block->outBuffer = NULL;
+	block->outBufferSize = 0;
+}
+
+/*-------------------------------------------------
+    _7z_block_get - find the slot holding folder
+    folderIndex, or free up one for it to be
+    decoded into
+-------------------------------------------------*/
+
+static _7z_block *_7z_block_get(_7z_file *_7z, UInt32 folderIndex)
+{
+	_7z_block *slot = NULL;
+	int i;
+
+	for (i = 0; i < _7Z_BLOCK_SLOTS; i++)
+	{
+		_7z_block *block = &_7z->blocks[i];
+
+		if (block->outBuffer && block->blockIndex == folderIndex)
+		{
+			block->lastUse = ++_7z_block_clock;
+			return block;
+		}
+
+		if (slot == NULL || (slot->outBuffer && (block->outBuffer == NULL || block->lastUse < slot->lastUse)))
+			slot = block;
+	}
+
+	_7z_block_free(_7z, slot);
+
+	/* make room, dropping the least recently used blocks of any archive */
+	size_t needed = (size_t)SzAr_GetFolderUnpackSize(&_7z->db.db, folderIndex);
+
+	while (_7z_block_bytes && _7z_block_bytes + needed > _7Z_BLOCK_BUDGET)
+	{
+		_7z_file *owner = NULL;
+		_7z_block *oldest = NULL;
+
+		for (_7z_file *f = _7z_live; f != NULL; f = f->next_live)
+			for (i = 0; i < _7Z_BLOCK_SLOTS; i++)
+				if (f->blocks[i].outBuffer && (oldest == NULL || f->blocks[i].lastUse < oldest->lastUse))
+				{
+					owner = f;
+					oldest = &f->blocks[i];
+				}
+
+		if (oldest == NULL)
+			break;
+
+		_7z_block_free(owner, oldest);
+	}
+
+	slot->blockIndex = 0xFFFFFFFF;
+	slot->lastUse = ++_7z_block_clock;
+
+	return slot;
+}
+
 _7z_error _7z_file_decompress(_7z_file *new_7z, void *buffer, UINT32 length, UINT32 *Processed)
 {
 	SRes res;
@@ -477,17 +550,38 @@ _7z_error _7z_file_decompress(_7z_file *new_7z, void *buffer, UINT32 length, UIN
 	size_t offset = 0;
 	size_t outSizeProcessed = 0;
 
+	UInt32 folderIndex = new_7z->db.FileToFolder[index];
+
+	if (folderIndex == (UInt32)-1)
+	{
+		/* empty file */
+		*Processed = 0;
+		return _7ZERR_NONE;
+	}
+
+	_7z_block *block = _7z_block_get(new_7z, folderIndex);
+	bool decoded = (block->outBuffer == NULL);
+
+	/* with the block already in the slot this only locates (and crc checks) the file */
 	res = SzArEx_Extract(&new_7z->db, &new_7z->lookStream.s, index,
-		&new_7z->blockIndex, &new_7z->outBuffer, &new_7z->outBufferSize,
+		&block->blockIndex, &block->outBuffer, &block->outBufferSize,
 		&offset, &outSizeProcessed,
 		&new_7z->allocImp, &new_7z->allocTempImp);
 
+	if (decoded && block->outBuffer)
+		_7z_block_bytes += block->outBufferSize;
+
 	if (res != SZ_OK)
+	{
+		/* don't keep a block which didn't decode */
+		if (res != SZ_ERROR_CRC)
+			_7z_block_free(new_7z, block);
 		return _7ZERR_FILE_ERROR;
+	}
 
 	*Processed = outSizeProcessed;
 
-	memcpy(buffer, new_7z->outBuffer + offset, length);
+	memcpy(buffer, block->outBuffer + offset, (length < outSizeProcessed) ? length : outSizeProcessed);
 
 	return _7ZERR_NONE;
 }
@@ -513,9 +607,17 @@ static void free__7z_file(_7z_file *_7z)
 			free((void *)_7z->filename);
 
 
-		if (_7z->outBuffer) IAlloc_Free(&_7z->allocImp, _7z->outBuffer);
+		for (int i = 0; i < _7Z_BLOCK_SLOTS; i++)
+			_7z_block_free(_7z, &_7z->blocks[i]);
 		if (_7z->inited) SzArEx_Free(&_7z->db, &_7z->allocImp);
 
+		for (_7z_file **link = &_7z_live; *link != NULL; link = &(*link)->next_live)
+			if (*link == _7z)
+			{
+				*link = _7z->next_live;
+				break;
+			}
+
 
 		free(_7z);
 	}
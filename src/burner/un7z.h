@@ -128,6 +128,18 @@ typedef enum __7z_error _7z_error;
     TYPE DEFINITIONS
 ***************************************************************************/
 
+/* number of decoded solid blocks kept per archive */
+#define _7Z_BLOCK_SLOTS	8
+
+/* a decoded solid block */
+typedef struct
+{
+	UInt32 blockIndex;						/* folder it holds */
+	Byte *outBuffer;						/* NULL when the slot is free */
+	size_t outBufferSize;
+	UINT32 lastUse;							/* for dropping the least recently used */
+} _7z_block;
+
 /* describes an open _7Z file */
 typedef struct __7z_file _7z_file;
 struct __7z_file
@@ -146,10 +158,10 @@ struct __7z_file
 	ISzAlloc allocTempImp;
 	bool inited;
 
-	// cached stuff for solid blocks
-	UInt32 blockIndex;// = 0xFFFFFFFF; /* it can have any value before first call (if outBuffer = 0) */
-	Byte *outBuffer;// = 0; /* it must be 0 before first call for each new archive. */
-	size_t outBufferSize;// = 0;  /* it can have any value before first call (if outBuffer = 0) */
+	// solid blocks decoded so far, so a block is only decompressed once however
+	// the roms in it are asked for (see _7z_file_decompress)
+	_7z_block blocks[_7Z_BLOCK_SLOTS];
+	_7z_file *next_live;					/* every open or cached archive, for the block budget */
 };
 
 
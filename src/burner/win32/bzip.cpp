@@ -1,11 +1,12 @@
 // Burner Zip module
 #include "burner.h"
+#include "burn_profile.h"
 
 int nBzipError = 0;												// non-zero if there is a problem with the opened romset
 
 static TCHAR* szBzipName[BZIP_MAX] = { NULL, };					// Zip files to search through
 
-struct RomFind { int nState; int nZip; int nPos; };				// State is non-zero if found. 1 = found totally okay.
+struct RomFind { int nState; int nZip; int nPos; unsigned int nCrc; };				// State is non-zero if found. 1 = found totally okay.
 static struct RomFind* RomFind = NULL;
 static int nRomCount = 0; static int nTotalSize = 0;
 static struct ZipEntry* List = NULL; static int nListCount = 0;	// List of entries for current zip file
@@ -340,14 +341,21 @@ static int __cdecl BzipBurnLoadRom(unsigned char* Dest, int* pnWrote, int i)
 	if (nCurrentZip != nWantZip) {							// If we haven't got the right zip file currently open
 		ZipClose();
 		nCurrentZip = -1;
-		if (ZipOpen(TCHARToANSI(szBzipName[nWantZip], NULL, 0))) {
+		BurnProfileBegin("archive open");
+		nRet = ZipOpen(TCHARToANSI(szBzipName[nWantZip], NULL, 0));
+		BurnProfileEnd();
+		if (nRet) {
 			return 1;
 		}
 		nCurrentZip = nWantZip;
 	}
 
 	// Read in file and return how many bytes we read
-	if (ZipLoadFile(Dest, ri.nLen, pnWrote, RomFind[i].nPos)) {
+	BurnProfileBegin("rom inflate");
+	nRet = ZipLoadFile(Dest, ri.nLen, pnWrote, RomFind[i].nPos);
+	BurnProfileEnd();
+
+	if (nRet) {
 
 		// Error loading from the zip file
 		FBAPopupAddText(PUF_TEXT_DEFAULT, MAKEINTRESOURCE(nRet == 2 ? IDS_ERR_LOAD_DISK_CRC : IDS_ERR_LOAD_DISK), pszRomName, GetFilenameW(szBzipName[nCurrentZip]));
@@ -359,6 +367,17 @@ static int __cdecl BzipBurnLoadRom(unsigned char* Dest, int* pnWrote, int i)
 	return 0;
 }
 
+// The crc of the file found for rom i (which may not be the one the driver expects), the
+// decoded ROM cache is keyed on these so a bad dump never hands its data to the good set
+static unsigned int __cdecl BzipBurnRomCrc(int i)
+{
+	if (RomFind == NULL || i < 0 || i >= nRomCount || RomFind[i].nState == 0) {
+		return 0;
+	}
+
+	return RomFind[i].nCrc;
+}
+
 // ----------------------------------------------------------------------------
 
 int BzipStatus()
@@ -467,7 +486,11 @@ int BzipOpen(bool bootApp)
 			continue;
 		}
 
-		if (ZipOpen(TCHARToANSI(szBzipName[z], NULL, 0)) == 0) {		// Open the rom zip file
+		BurnProfileBegin("archive open");
+		INT32 nOpen = ZipOpen(TCHARToANSI(szBzipName[z], NULL, 0));		// Open the rom zip file
+		BurnProfileEnd();
+
+		if (nOpen == 0) {
 			nCurrentZip = z;
 
 			ZipGetList(&List, &nListCount);								// Get the list of entries
@@ -490,6 +513,7 @@ int BzipOpen(bool bootApp)
 
 				RomFind[i].nZip = z;									// Remember which zip file it is in
 				RomFind[i].nPos = nFind;
+				RomFind[i].nCrc = List[nFind].nCrc;						// What will actually be loaded
 				RomFind[i].nState = 1;									// Set to found okay
 
 				BurnDrvGetRomInfo(&ri, i);								// Get info about the rom
@@ -628,6 +652,7 @@ int BzipOpen(bool bootApp)
 		}
 
 		BurnExtLoadRom = BzipBurnLoadRom;								// Okay to call our function to load each rom
+		BurnExtRomCrc = BzipBurnRomCrc;
 
 	} else {
 		// check for hard drive images (assumed max one per game)
@@ -663,9 +688,11 @@ int BzipOpen(bool bootApp)
 int BzipClose()
 {
 	ZipClose();
+	ZipCacheClear();
 	nCurrentZip = -1;													// Close the last zip file if open
 
 	BurnExtLoadRom = NULL;												// Can't call our function to load each rom anymore
+	BurnExtRomCrc = NULL;
 	nBzipError = 0;														// reset romset errors
 
 	if (RomFind) {
@@ -165,6 +165,8 @@ int ConfigAppLoad()
 		VAR(nAudSegCount);
 		VAR(nInterpolation);
 		VAR(nFMInterpolation);
+		VAR(bBurnSampleStreaming);
+		VAR(nBurnADPCMCacheSize);
 		VAR(nAudSampleRate[0]);
 		VAR(nAudDSPModule[0]);
 		VAR(nAudSampleRate[1]);
@@ -510,6 +512,10 @@ int ConfigAppSave()
 	VAR(nInterpolation);
 	_ftprintf(h, _T("\n// The order of FM interpolation\n"));
 	VAR(nFMInterpolation);
+	_ftprintf(h, _T("\n// If non-zero, keep samples as loaded and convert them as they play (less memory)\n"));
+	VAR(bBurnSampleStreaming);
+	_ftprintf(h, _T("\n// Size in KB of the pre-decoded ADPCM sample cache (MSM6295, YM2610), 0 = off\n"));
+	VAR(nBurnADPCMCacheSize);
 	_ftprintf(h, _T("\n"));
 	_ftprintf(h, _T("// --- DirectSound plugin settings --------------------------------------------\n"));
 	_ftprintf(h, _T("\n// Sample rate\n"));
@@ -1,6 +1,7 @@
 // Driver Init module
 #include "burner.h"
 #include "neocdlist.h"
+#include "burn_profile.h"
 
 int bDrvOkay = 0;						// 1 if the Driver has been initted okay, and it's okay to use the BurnDrv functions
 
@@ -52,7 +53,10 @@ static int DoLibInit()					// Do Init of Burn library driver
 {
 	int nRet = 0;
 
+	BurnProfileStart(BurnDrvGetTextA(DRV_NAME));		// the report covers the archive scan as well
+
 	if (DrvBzipOpen()) {
+		BurnProfileStop();
 		return 1;
 	}
 
@@ -63,6 +67,7 @@ static int DoLibInit()					// Do Init of Burn library driver
 	nRet = BurnDrvInit();
 
 	BzipClose();
+	BurnProfileStop();
 
 	if (!bQuietLoading) ProgressDestroy();
 
@@ -1,11 +1,19 @@
 // Zip module
 #include "burner.h"
+#include "burn_profile.h"
 #include "unzip.h"
 
 #ifdef INCLUDE_7Z_SUPPORT
 #include "un7z.h"
 #endif
 
+#if defined(__unix__) || defined(__APPLE__)
+#define ZIPFN_MMAP
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #define ZIPFN_FILETYPE_NONE		-1
 #define ZIPFN_FILETYPE_ZIP		1
 #define ZIPFN_FILETYPE_7ZIP		2
@@ -14,6 +22,7 @@ static INT32 nFileType = ZIPFN_FILETYPE_NONE;
 
 static unzFile Zip = NULL;
 static INT32 nCurrFile = 0; // The current file we are pointing to
+static char szZipFileName[MAX_PATH]; // and its file name
 
 #ifdef INCLUDE_7Z_SUPPORT
 static _7z_file* _7ZipFile = NULL;
@@ -31,6 +40,7 @@ INT32 ZipOpen(char* szZip)
 	Zip = unzOpen(szFileName);
 	if (Zip != NULL) {
 		nFileType = ZIPFN_FILETYPE_ZIP;
+		strcpy(szZipFileName, szFileName);
 		unzGoToFirstFile(Zip);
 		nCurrFile = 0;
 
@@ -196,6 +206,80 @@ INT32 ZipGetList(struct ZipEntry** pList, INT32* pnListCount)
 	return 0;
 }
 
+#ifdef ZIPFN_MMAP
+// Entries stored without compression are read straight from the archive into Dest.  With
+// bBurnZipMapShare set, where the entry data and Dest line up on page boundaries (the archive
+// was written with its entries page aligned) and Dest lies in one of the blocks BurnMalloc
+// mmaps for rom regions (never a heap block, MAP_FIXED would pull it out from under malloc),
+// the whole pages are mapped in place instead: no copy, no memory of our own until a page
+// gets written (MAP_PRIVATE, so drivers can still patch or decrypt their roms), and instances
+// running the same set share the pages through the page cache.  BurnFree() munmaps the block
+// and the file mappings in it together.  The unwritten pages stay backed by the archive
+// though, replacing or truncating it while the game runs changes the roms under it or raises
+// SIGBUS, so it's left to the user to turn on.
+// Returns -1 when the entry isn't stored, the caller reads it as usual, else as ZipLoadFile
+static INT32 ZipLoadStored(const char* szFileName, unzFile hZip, UINT8* Dest, INT32 nLen, INT32* pnWrote)
+{
+	unz_file_info FileInfo;
+	memset(&FileInfo, 0, sizeof(FileInfo));
+
+	if (unzGetCurrentFileInfo(hZip, &FileInfo, NULL, 0, NULL, 0, NULL, 0) != UNZ_OK) return -1;
+	if (FileInfo.compression_method != 0 || (FileInfo.flag & 1)) return -1;			// deflated or encrypted
+
+	ZPOS64_T nOffset = unzGetCurrentFileZStreamPos64(hZip);							// after unzOpenCurrentFile
+	if (nOffset == 0) return -1;
+
+	INT32 fd = open(szFileName, O_RDONLY);
+	if (fd < 0) return -1;
+
+	INT32 nSize = ((INT64)FileInfo.uncompressed_size < nLen) ? (INT32)FileInfo.uncompressed_size : nLen;
+	INT64 nPage = sysconf(_SC_PAGESIZE);
+	INT64 nHead = nSize;																// read, before the mapped pages
+	INT64 nBody = 0;																	// mapped
+
+	if (bBurnZipMapShare && nPage > 0 && (((uintptr_t)Dest - nOffset) & (nPage - 1)) == 0 && BurnMallocMapped(Dest, nSize)) {
+		nHead = (nPage - ((uintptr_t)Dest & (nPage - 1))) & (nPage - 1);
+		if (nHead > nSize) nHead = nSize;
+		nBody = ((nSize - nHead) / nPage) * nPage;
+
+		if (nBody && mmap(Dest + nHead, nBody, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, nOffset + nHead) == MAP_FAILED) {
+			// put anonymous pages back (a failed MAP_FIXED may have dropped what was there) and read it all
+			mmap(Dest + nHead, nBody, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+			nHead = nSize;
+			nBody = 0;
+		}
+	}
+
+	INT32 nRet = 0;
+
+	for (INT64 nPos = 0; nPos < nSize && nRet == 0; ) {
+		if (nPos == nHead && nBody) nPos += nBody;										// skip the mapped part
+		if (nPos >= nSize) break;
+
+		INT64 nEnd = (nPos < nHead) ? nHead : nSize;
+		ssize_t nRead = pread(fd, Dest + nPos, nEnd - nPos, nOffset + nPos);
+		if (nRead <= 0) nRet = 1;
+		nPos += nRead;
+	}
+
+	close(fd);
+
+	if (nRet) return 1;
+
+	// Return how many bytes were copied
+	if (pnWrote != NULL) *pnWrote = nSize;
+
+	// unzCloseCurrentFile() only checks the crc once the whole entry went through unzReadCurrentFile
+	BurnProfileBegin("rom crc");
+	nRet = (nSize == (INT64)FileInfo.uncompressed_size && crc32(0, Dest, nSize) != FileInfo.crc);
+	BurnProfileEnd();
+
+	if (nRet) return 2;
+
+	return 0;
+}
+#endif
+
 INT32 ZipLoadFile(UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry)
 {
 	if (nFileType == ZIPFN_FILETYPE_ZIP && Zip == NULL) return 1;
@@ -226,6 +310,14 @@ INT32 ZipLoadFile(UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry)
 		nRet = unzOpenCurrentFile(Zip);
 		if (nRet != UNZ_OK) return 1;
 
+#ifdef ZIPFN_MMAP
+		INT32 nStored = ZipLoadStored(szZipFileName, Zip, Dest, nLen, pnWrote);
+		if (nStored >= 0) {
+			unzCloseCurrentFile(Zip);
+			return nStored;
+		}
+#endif
+
 		nRet = unzReadCurrentFile(Zip, Dest, nLen);
 		// Return how many bytes were copied
 		if (nRet >= 0 && pnWrote != NULL) *pnWrote = nRet;
@@ -249,7 +341,9 @@ INT32 ZipLoadFile(UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry)
 		if (_7zerr == _7ZERR_NONE && pnWrote != NULL) *pnWrote = (INT32)nWrote;
 
 		// use zlib crc32 module to calc crc of decompressed data, and check against 7z header
+		BurnProfileBegin("rom crc");
 		UINT32 nCalcCrc = crc32(0, Dest, nWrote);
+		BurnProfileEnd();
 		if (nCalcCrc != crc) return 2;
 	}
 #endif
@@ -257,6 +351,83 @@ INT32 ZipLoadFile(UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 nEntry)
 	return 0;
 }
 
+// Free the archives ZipClose() keeps open for the next ZipOpen(), along with the solid
+// blocks decoded from them, once a set has been loaded
+void ZipCacheClear()
+{
+#ifdef INCLUDE_7Z_SUPPORT
+	_7z_file_cache_clear();
+#endif
+}
+
+// Load entry nEntry (as numbered by ZipGetList) from szZip.zip on a handle of its own, so
+// it doesn't disturb the archive opened by ZipOpen and can run on several threads at once.
+// The entry is inflated a piece at a time, if pCancel is given and returns nonzero between
+// pieces the load is given up and 1 returned
+#define ZIP_ENTRY_CHUNK		(1 << 20)
+
+INT32 ZipLoadEntry(char* szZip, INT32 nEntry, UINT8* Dest, INT32 nLen, INT32* pnWrote, INT32 (*pCancel)())
+{
+	if (szZip == NULL) return 1;
+
+	char szFileName[MAX_PATH];
+	sprintf(szFileName, "%s.zip", szZip);
+
+	unzFile EntryZip = unzOpen(szFileName);
+	if (EntryZip == NULL) return 1;
+
+	INT32 nRet = unzGoToFirstFile(EntryZip);
+
+	for (INT32 i = 0; i < nEntry && nRet == UNZ_OK; i++) {
+		nRet = unzGoToNextFile(EntryZip);
+	}
+
+	if (nRet == UNZ_OK) nRet = unzOpenCurrentFile(EntryZip);
+	if (nRet != UNZ_OK) {
+		unzClose(EntryZip);
+		return 1;
+	}
+
+#ifdef ZIPFN_MMAP
+	INT32 nStored = ZipLoadStored(szFileName, EntryZip, Dest, nLen, pnWrote);
+	if (nStored >= 0) {
+		unzCloseCurrentFile(EntryZip);
+		unzClose(EntryZip);
+		return nStored;
+	}
+#endif
+
+	INT32 nRead = 0;
+	while (nRead < nLen) {
+		if (pCancel && pCancel()) {
+			unzCloseCurrentFile(EntryZip);
+			unzClose(EntryZip);
+			return 1;
+		}
+
+		INT32 nChunk = unzReadCurrentFile(EntryZip, Dest + nRead, (nLen - nRead < ZIP_ENTRY_CHUNK) ? (nLen - nRead) : ZIP_ENTRY_CHUNK);
+		if (nChunk < 0) {
+			unzCloseCurrentFile(EntryZip);
+			unzClose(EntryZip);
+			return 1;
+		}
+		if (nChunk == 0) break;
+
+		nRead += nChunk;
+	}
+
+	// Return how many bytes were copied
+	if (pnWrote != NULL) *pnWrote = nRead;
+
+	nRet = unzCloseCurrentFile(EntryZip);	// checks the crc of what was read
+	unzClose(EntryZip);
+
+	if (nRet == UNZ_CRCERROR) return 2;
+	if (nRet != UNZ_OK) return 1;
+
+	return 0;
+}
+
 // Load one file directly, added by regret
 INT32 __cdecl ZipLoadOneFile(char* arcName, const char* fileName, void** Dest, INT32* pnWrote)
 {
@@ -5,6 +5,7 @@
 #include "burnint.h"
 #include "m68000_intf.h"
 #include "m68000_debug.h"
+#include "burn_profile.h"
 
 #ifdef EMU_M68K
 INT32 nSekM68KContextSize[SEK_MAX];
@@ -1022,6 +1023,8 @@ INT32 SekInit(INT32 nCount, INT32 nCPUType)
 {
 	DebugCPU_SekInitted = 1;
 	
+	BurnProfileBegin("cpu init");
+
 	struct SekExt* ps = NULL;
 
 /*#if !defined BUILD_A68K
@@ -1041,6 +1044,7 @@ INT32 SekInit(INT32 nCount, INT32 nCPUType)
 	SekExt[nCount] = (struct SekExt*)malloc(sizeof(struct SekExt));
 	if (SekExt[nCount] == NULL) {
 		SekExit();
+		BurnProfileEnd();
 		return 1;
 	}
 	memset(SekExt[nCount], 0, sizeof(struct SekExt));
@@ -1137,6 +1141,7 @@ INT32 SekInit(INT32 nCount, INT32 nCPUType)
 	if (bBurnUseASMCPUEmulation && nCPUType == 0x68000) {
 		if (SekInitCPUA68K(nCount, nCPUType)) {
 			SekExit();
+			BurnProfileEnd();
 			return 1;
 		}
 	} else {
@@ -1146,6 +1151,7 @@ INT32 SekInit(INT32 nCount, INT32 nCPUType)
 		m68k_init();
 		if (SekInitCPUM68K(nCount, nCPUType)) {
 			SekExit();
+			BurnProfileEnd();
 			return 1;
 		}
 #endif
@@ -1166,6 +1172,8 @@ INT32 SekInit(INT32 nCount, INT32 nCPUType)
 
 	CpuCheatRegister(nCount, &SekConfig);
 
+	BurnProfileEnd();
+
 	return 0;
 }
 
@@ -1,6 +1,7 @@
 // Z80 (Zed Eight-Ty) Interface
 #include "burnint.h"
 #include "z80_intf.h"
+#include "burn_profile.h"
 #include <stddef.h>
 
 #define MAX_Z80		8
@@ -205,6 +206,8 @@ INT32 ZetInit(INT32 nCPU)
 {
 	DebugCPU_ZetInitted = 1;
 
+	BurnProfileBegin("cpu init");
+
 	nOpenedCPU = -1;
 
 	ZetCPUContext[nCPU] = (struct ZetExt*)BurnMalloc(sizeof(ZetExt));
@@ -246,6 +249,8 @@ INT32 ZetInit(INT32 nCPU)
 
 	CpuCheatRegister(nCPU, &ZetConfig);
 
+	BurnProfileEnd();
+
 	return 0;
 }
 
@@ -5,21 +5,29 @@
 //  This module just fakes the "dsp.c" functions of FinalBurn and uses
 //  a IIR low pass filter, which is pretty faster and has a better
 //  frequency response.
-
+//
+//  The post-mix stages (low-pass, reverb, stereo widen) now run
+//  in a single pass over the interleaved stereo segment, in float.  The
+//  low-pass keeps the two parallel resonant sections of LowPass2, which
+//  for stereo gives four independent biquads - one SSE register.
 
 #include <stdlib.h>
+#include <string.h>
+#include <math.h>
 #include "burner.h"
-#include "lowpass2.h"
+#include "aud_dsp.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DSP_SSE2
+#include <emmintrin.h>
+#endif
 
 // NOTE: don't modify these defines unless you are 100% sure you know how
 //   to deal with the parameters of a 2nd order resonant lowpass filter.
-//   DO NOT EVEN MODIFY SampleFreq!!!!
 //
 //   BTW: if you are curious, these parameters imitate the behavour of
 //   finalburn's "old" convolution filter.
 // ----------------------------------------------------------------------
-#define SampleFreq 44100.0
-
 #define CutFreq 14000.0
 #define Q 0.4
 #define Gain 1.0
@@ -28,37 +36,220 @@
 #define Q2 0.3
 #define Gain2 1.475
 
+#define WidenAmount	1.6f		// side gain, 1.0 = untouched
+
+#define ReverbCombs	2
+#define ReverbWet	0.22f
+#define ReverbRoom	0.78f
+#define ReverbDamp	0.25f
+
+static const INT32 ReverbCombTune[2][ReverbCombs] = { { 1116, 1557 }, { 1139, 1580 } };	// freeverb tunings @ 44.1kHz
+static const INT32 ReverbAllpassTune[2] = { 556, 579 };
 
-class LowPass2 *LP1 = NULL, *LP2 = NULL;
+// lanes: left A, right A, left B, right B (A = CutFreq section, B = CutFreq2 section)
+struct DspBiquad {
+	float b0[4], b1[4], b2[4], a1[4], a2[4];
+	float x1[4], x2[4], y1[4], y2[4];
+};
 
+struct DspReverbLine {
+	float *pBuf;
+	INT32 nLen;
+	INT32 nPos;
+	float fStore;
+};
 
-INT32 DspDo(INT16 *Buff, INT32 Len)
+static DspBiquad LowPass;
+static DspReverbLine ReverbComb[2][ReverbCombs];
+static DspReverbLine ReverbAllpass[2];
+static float *ReverbMem = NULL;
+static bool bDspOkay = false;
+
+static void DspBiquadSection(float Freq, float SampleRate, float q, float g, INT32 nLane)
+{
+	if (q < 0) q = 0;
+	if (Freq < 0) Freq = 0;
+	if (Freq > SampleRate / 2) Freq = SampleRate / 2;
+
+	double omega = 3.141592653589793 * 2 * Freq / SampleRate;
+	double sn = sin(omega);
+	double cs = cos(omega);
+	double alpha = sn / (2 * q);
+
+	for (INT32 i = nLane; i < nLane + 2; i++) {
+		LowPass.b0[i] = (float)(((1 - cs) / 2) * g / (1 + alpha));
+		LowPass.b1[i] = (float)((1 - cs) * g / (1 + alpha));
+		LowPass.b2[i] = (float)(((1 - cs) / 2) * g / (1 + alpha));
+		LowPass.a1[i] = (float)((-2 * cs) / (1 + alpha));
+		LowPass.a2[i] = (float)((1 - alpha) / (1 + alpha));
+	}
+}
+
+static inline float DspReverbProcess(INT32 nChannel, float fIn)
 {
-  if ((!LP1) || (!LP2)) { return 1; }
+	float fOut = 0.0f;
+
+	for (INT32 i = 0; i < ReverbCombs; i++) {
+		DspReverbLine *c = &ReverbComb[nChannel][i];
+		float y = c->pBuf[c->nPos];
+		c->fStore = y * (1.0f - ReverbDamp) + c->fStore * ReverbDamp;
+		c->pBuf[c->nPos] = fIn + c->fStore * ReverbRoom;
+		if (++c->nPos >= c->nLen) c->nPos = 0;
+		fOut += y;
+	}
+
+	DspReverbLine *a = &ReverbAllpass[nChannel];
+	float b = a->pBuf[a->nPos];
+	a->pBuf[a->nPos] = fOut + b * 0.5f;
+	if (++a->nPos >= a->nLen) a->nPos = 0;
+
+	return b - fOut;
+}
+
+static inline INT16 DspClip(float f)
+{
+	if (f >  32767.0f) return  32767;
+	if (f < -32768.0f) return -32768;
+	return (INT16)f;
+}
+
+// one specialisation per combination of stages, so disabled stages cost nothing
+template <INT32 nStages>
+static void DspRun(INT16 *Buff, INT32 Len)
+{
+#if defined DSP_SSE2
+	__m128 b0 = _mm_loadu_ps(LowPass.b0), b1 = _mm_loadu_ps(LowPass.b1), b2 = _mm_loadu_ps(LowPass.b2);
+	__m128 a1 = _mm_loadu_ps(LowPass.a1), a2 = _mm_loadu_ps(LowPass.a2);
+	__m128 x1 = _mm_loadu_ps(LowPass.x1), x2 = _mm_loadu_ps(LowPass.x2);
+	__m128 y1 = _mm_loadu_ps(LowPass.y1), y2 = _mm_loadu_ps(LowPass.y2);
+#endif
+
+	for (INT32 i = 0; i < Len; i++, Buff += 2) {
+		float l = Buff[0];
+		float r = Buff[1];
+
+		if (nStages & DSP_LOWPASS) {
+#if defined DSP_SSE2
+			__m128 x = _mm_setr_ps(l, r, l, r);
+			__m128 y = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(b0, x), _mm_mul_ps(b1, x1)), _mm_mul_ps(b2, x2)),
+			                      _mm_add_ps(_mm_mul_ps(a1, y1), _mm_mul_ps(a2, y2)));
+			x2 = x1; x1 = x;
+			y2 = y1; y1 = y;
+
+			float out[4];
+			_mm_storeu_ps(out, _mm_add_ps(y, _mm_movehl_ps(y, y)));
+			l = out[0];
+			r = out[1];
+#else
+			float x[4] = { l, r, l, r };
+			float y[4];
+			for (INT32 j = 0; j < 4; j++) {
+				y[j] = LowPass.b0[j] * x[j] + LowPass.b1[j] * LowPass.x1[j] + LowPass.b2[j] * LowPass.x2[j]
+				     - LowPass.a1[j] * LowPass.y1[j] - LowPass.a2[j] * LowPass.y2[j];
+				LowPass.x2[j] = LowPass.x1[j]; LowPass.x1[j] = x[j];
+				LowPass.y2[j] = LowPass.y1[j]; LowPass.y1[j] = y[j];
+			}
+			l = y[0] + y[2];
+			r = y[1] + y[3];
+#endif
+		}
+
+		if (nStages & DSP_REVERB) {
+			float in = (l + r) * 0.015f;
+			l += DspReverbProcess(0, in) * ReverbWet;
+			r += DspReverbProcess(1, in) * ReverbWet;
+		}
+
+		if (nStages & DSP_WIDEN) {
+			float m = (l + r) * 0.5f;
+			float s = (l - r) * 0.5f * WidenAmount;
+			l = m + s;
+			r = m - s;
+		}
+
+		Buff[0] = DspClip(l);
+		Buff[1] = DspClip(r);
+	}
+
+#if defined DSP_SSE2
+	if (nStages & DSP_LOWPASS) {
+		_mm_storeu_ps(LowPass.x1, x1); _mm_storeu_ps(LowPass.x2, x2);
+		_mm_storeu_ps(LowPass.y1, y1); _mm_storeu_ps(LowPass.y2, y2);
+	}
+#endif
+}
+
+typedef void (*DspRunFn)(INT16 *, INT32);
+
+static const DspRunFn DspRunTable[8] = {
+	DspRun<0>,  DspRun<1>,  DspRun<2>,  DspRun<3>,  DspRun<4>,  DspRun<5>,  DspRun<6>,  DspRun<7>
+};
+
+INT32 DspDo(INT16 *Buff, INT32 Len, INT32 nStages)
+{
+	nStages &= DSP_ALL;
+
+	if (!bDspOkay || nStages == 0) { return 1; }
+
+	if ((nStages & DSP_LOWPASS) && bRunPause) {	// LowPass2 muted the looping segment while paused
+		memset(Buff, 0, Len * 2 * sizeof(INT16));
+		return 0;
+	}
 
-  LP1->Filter(Buff, Len);	// Left
-  LP2->Filter(Buff+1, Len);	// Right
+	DspRunTable[nStages](Buff, Len);
 
-  return 0;
+	return 0;
 }
 
 
 INT32 DspInit(void)
 {
-  LP1 = new LowPass2(CutFreq, SampleFreq, Q, Gain,
-                     CutFreq2, Q2, Gain2);
-  LP2 = new LowPass2(CutFreq, SampleFreq, Q, Gain,
-                     CutFreq2, Q2, Gain2);
-  return 0;
+	float SampleRate = (float)nAudSampleRate[nAudSelect];
+	if (SampleRate <= 0) SampleRate = 44100.0f;
+
+	memset(&LowPass, 0, sizeof(LowPass));
+	DspBiquadSection(CutFreq,  SampleRate, Q,  Gain,  0);
+	DspBiquadSection(CutFreq2, SampleRate, Q2, Gain2, 2);
+
+	INT32 nTotal = 0;
+	for (INT32 c = 0; c < 2; c++) {
+		for (INT32 i = 0; i < ReverbCombs; i++) {
+			nTotal += ReverbComb[c][i].nLen = (INT32)(ReverbCombTune[c][i] * SampleRate / 44100.0f) + 1;
+		}
+		nTotal += ReverbAllpass[c].nLen = (INT32)(ReverbAllpassTune[c] * SampleRate / 44100.0f) + 1;
+	}
+
+	ReverbMem = (float*)calloc(nTotal, sizeof(float));
+	if (ReverbMem == NULL) {
+		return 1;
+	}
+
+	float *pMem = ReverbMem;
+	for (INT32 c = 0; c < 2; c++) {
+		for (INT32 i = 0; i < ReverbCombs; i++) {
+			ReverbComb[c][i].pBuf = pMem;
+			ReverbComb[c][i].nPos = 0;
+			ReverbComb[c][i].fStore = 0.0f;
+			pMem += ReverbComb[c][i].nLen;
+		}
+		ReverbAllpass[c].pBuf = pMem;
+		ReverbAllpass[c].nPos = 0;
+		pMem += ReverbAllpass[c].nLen;
+	}
+
+	bDspOkay = true;
+
+	return 0;
 }
 
 INT32 DspExit(void)
 {
-  delete LP1;
-  delete LP2;
+	bDspOkay = false;
 
-  LP1 = NULL;
-  LP2 = NULL;
+	if (ReverbMem) {
+		free(ReverbMem);
+		ReverbMem = NULL;
+	}
 
-  return 0;
+	return 0;
 }
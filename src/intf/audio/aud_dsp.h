@@ -1,4 +1,9 @@
 // dsp.cpp
+#define DSP_LOWPASS		(1 << 0)	// 2nd order resonant low-pass (imitates the old convolution filter)
+#define DSP_REVERB		(1 << 1)
+#define DSP_WIDEN		(1 << 2)
+#define DSP_ALL			(DSP_LOWPASS | DSP_REVERB | DSP_WIDEN)
+
 INT32 DspInit();
 INT32 DspExit();
-INT32 DspDo(INT16* Wave, INT32 nCount);
+INT32 DspDo(INT16* Wave, INT32 nCount, INT32 nStages);
@@ -9,7 +9,8 @@ INT32 nAudAllocSegLen = 0;
 UINT8 bAudOkay = 0;			// True if DSound was initted okay
 UINT8 bAudPlaying = 0;		// True if the Loop buffer is playing
 
-INT32 nAudDSPModule[8] = { 0, };				// DSP module to use: 0 = none, 1 = low-pass filter
+INT32 nAudDSPModule[8] = { 0, };				// DSP stages to use (aud_dsp.h): 0 = none, 1 = low-pass, 2 = reverb, 4 = stereo widen
+INT32 nAudLatency = 20;					// Target latency (ms) for the ring buffer backends (SDL, PulseAudio)
 
 INT16* nAudNextSound = NULL;		// The next sound seg we will add to the sample loop
 
@@ -173,9 +174,15 @@ InterfaceInfo* AudGetInfo()
 		_sntprintf(szString, MAX_PATH, _T("Playback at %iHz, %i%% volume"), nAudSampleRate[nAudActive], nAudVolume / 100);
 		IntInfoAddStringInterface(&AudInfo, szString);
 
-		if (nAudDSPModule[nAudActive]) {
+		if (nAudDSPModule[nAudActive] & 1) {
 			IntInfoAddStringInterface(&AudInfo, _T("Applying low-pass filter"));
 		}
+		if (nAudDSPModule[nAudActive] & 2) {
+			IntInfoAddStringInterface(&AudInfo, _T("Applying reverb"));
+		}
+		if (nAudDSPModule[nAudActive] & 4) {
+			IntInfoAddStringInterface(&AudInfo, _T("Applying stereo widening"));
+		}
 
 	 	if (pAudOut[nAudSelect]->GetPluginSettings) {
 			pAudOut[nAudSelect]->GetPluginSettings(&AudInfo);
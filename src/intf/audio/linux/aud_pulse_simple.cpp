@@ -8,6 +8,8 @@
 #include "ringbuffer.h"
 
 static ring_buffer<short> *buffer = nullptr;
+static rate_control *rate = nullptr;
+static short *resample_buf = nullptr;
 static pa_simple *pa_stream = nullptr;
 static std::thread *streamer_thread = nullptr;
 static volatile bool streamer_stop = false;
@@ -15,6 +17,8 @@ static volatile bool streamer_is_running = false;
 
 // Samples per segment
 static int samples_per_segment = 0;
+// Samples we try to keep queued (nAudLatency)
+static size_t target_fill = 0;
 static unsigned int pas_sound_fps;
 static int (*pas_get_next_sound)(int);
 
@@ -35,14 +39,21 @@ static int pas_blank_sound()
 
 static int pas_sound_check()
 {
-    // 5 segments ahead...
-    if (buffer->size() >= (samples_per_segment * nAudSegCount)) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    size_t fill = buffer->size();
+    if (fill >= target_fill) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
         return 0;
     }
 
-    pas_get_next_sound(1);
-    buffer->write(nAudNextSound, samples_per_segment);
+    // refill up to the target latency, only draw the last frame
+    int segs = (int)((target_fill - fill + samples_per_segment - 1) / samples_per_segment);
+    for (int i = 0; i < segs; i++) {
+        pas_get_next_sound(i == segs - 1);
+
+        int frames = rate->frames(nAudSegLen, buffer->size() / 2, target_fill / 2);
+        ring_resample_stereo(nAudNextSound, nAudSegLen, resample_buf, frames);
+        buffer->write(resample_buf, frames * 2);
+    }
     return 0;
 }
 
@@ -64,20 +75,23 @@ static int pas_set_callback(int (*callback)(int))
 
 static void pas_audio_streamer(void)
 {
-    short *buf = new short[samples_per_segment];
+    // small chunks keep the ring (and not pulse) holding most of the latency
+    const size_t chunk = (target_fill / 4) & ~1;
+    short *buf = new short[chunk];
     streamer_is_running = true;
 
     while (!streamer_stop) {
         // playing...
         if (bAudPlaying) {
 
-            if (buffer->size() >= samples_per_segment) {
-                buffer->read(buf, samples_per_segment);
-            } else {
-                memset(buf, 0, samples_per_segment * 2);
+            size_t len = buffer->read(buf, chunk);
+            if (len == 0) {
+                // underrun, keep the stream fed with a short silence
+                len = chunk / 4 & ~1;
+                memset(buf, 0, len * 2);
             }
 
-            pa_simple_write(pa_stream, buf, samples_per_segment * 2, NULL);
+            pa_simple_write(pa_stream, buf, len * 2, NULL);
         } else {
             std::this_thread::sleep_for(std::chrono::microseconds(10));
         }
@@ -98,6 +112,10 @@ static int pas_init()
     // seglen * 2 channels * 2 bytes per sample (16bits)
     nAudAllocSegLen = samples_per_segment * 2;
 
+    target_fill = ((nAudSampleRate[0] * nAudLatency + 999) / 1000) * 2;
+    if (target_fill < (size_t)samples_per_segment)
+        target_fill = samples_per_segment;
+
     nAudNextSound = new short[samples_per_segment];
 
     pas_set_callback(nullptr);
@@ -116,7 +134,7 @@ static int pas_init()
     attributes.maxlength = -1;
     attributes.minreq = -1;
     attributes.prebuf = -1;
-    attributes.tlength = nAudAllocSegLen * nAudSegCount;
+    attributes.tlength = target_fill;     // half the latency in pulse, half in the ring
 
     if (streamer_thread) {
         streamer_stop = true;
@@ -136,11 +154,14 @@ static int pas_init()
     // destroy previous ring buffer
     if (buffer) {
         delete buffer;
+        delete rate;
+        delete [] resample_buf;
     }
 
-    // 6 segmentos no buffer
-    buffer = new ring_buffer<short>(samples_per_segment * nAudSegCount * 2);
-    buffer->virtual_write(samples_per_segment * (nAudSegCount));
+    // target plus a stretched segment of headroom
+    buffer = new ring_buffer<short>(target_fill + samples_per_segment * 4);
+    rate = new rate_control();
+    resample_buf = new short[samples_per_segment * 2];
     pa_stream = pa_simple_new(NULL,
                               "fbalpha",
                               PA_STREAM_PLAYBACK,
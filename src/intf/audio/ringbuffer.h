@@ -0,0 +1,171 @@
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+// Lock-free single-producer/single-consumer ring buffer shared by the
+// SDL and PulseAudio backends. The emulation thread is the only writer and
+// the audio device thread/callback is the only reader, so head and tail are
+// each owned by one side and only published through acquire/release atomics.
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+#define RING_CACHE_LINE	64
+
+template<class T>
+class ring_buffer {
+    // consumer side
+    std::atomic<size_t> head;
+    char pad0[RING_CACHE_LINE - sizeof(std::atomic<size_t>)];
+    // producer side
+    std::atomic<size_t> tail;
+    char pad1[RING_CACHE_LINE - sizeof(std::atomic<size_t>)];
+
+    T *buffer;
+    size_t buffer_size;     // always a power of two
+    size_t mask;
+
+public:
+    ring_buffer(size_t buffer_size_) {
+        buffer_size = 1;
+        while (buffer_size < buffer_size_)
+            buffer_size <<= 1;
+        mask = buffer_size - 1;
+
+        buffer = new T[buffer_size];
+        memset(buffer, 0, buffer_size * sizeof(T));
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+    }
+    ~ring_buffer() {
+        delete [] buffer;
+    }
+
+    size_t capacity() const {
+        return buffer_size;
+    }
+
+    // elements queued; exact for the consumer, a lower bound for the producer
+    size_t size() const {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+
+    size_t space() const {
+        return buffer_size - size();
+    }
+
+    bool available() const {
+        return size() > 0;
+    }
+
+    // producer only, returns the number of elements actually queued
+    size_t write(const T *buf, size_t length) {
+        const size_t tail_ = tail.load(std::memory_order_relaxed);
+        const size_t free_ = buffer_size - (tail_ - head.load(std::memory_order_acquire));
+        if (length > free_)
+            length = free_;
+
+        const size_t pos = tail_ & mask;
+        const size_t first = (length < buffer_size - pos) ? length : (buffer_size - pos);
+        memcpy(buffer + pos, buf, first * sizeof(T));
+        memcpy(buffer, buf + first, (length - first) * sizeof(T));
+
+        tail.store(tail_ + length, std::memory_order_release);
+        return length;
+    }
+
+    // consumer only, returns the number of elements actually dequeued
+    size_t read(T *buf, size_t length) {
+        const size_t head_ = head.load(std::memory_order_relaxed);
+        const size_t used = tail.load(std::memory_order_acquire) - head_;
+        if (length > used)
+            length = used;
+
+        const size_t pos = head_ & mask;
+        const size_t first = (length < buffer_size - pos) ? length : (buffer_size - pos);
+        memcpy(buf, buffer + pos, first * sizeof(T));
+        memcpy(buf + first, buffer, (length - first) * sizeof(T));
+
+        head.store(head_ + length, std::memory_order_release);
+        return length;
+    }
+
+    // consumer only, drop everything queued so far
+    void clear() {
+        head.store(tail.load(std::memory_order_acquire), std::memory_order_release);
+    }
+};
+
+// Dynamic rate control: every segment produced by the emulation is stretched
+// or squeezed by at most max_skew so the ring hovers around target_fill
+// instead of slowly running dry (crackle) or filling up (drift/latency).
+// All counts are in stereo frames.
+class rate_control {
+    double frac;
+    double max_skew;
+    double ratio;
+
+public:
+    rate_control(double max_skew_ = 0.005) : frac(0.0), max_skew(max_skew_), ratio(1.0) {}
+
+    void reset() {
+        frac = 0.0;
+    }
+
+    // nominal output/input ratio, e.g. to turn a rounded segment into an exact frame
+    void set_ratio(double ratio_) {
+        ratio = ratio_;
+    }
+
+    // number of frames in_frames should be resampled to
+    int frames(int in_frames, size_t fill, size_t target_fill) {
+        if (target_fill == 0) {
+            frac += in_frames * ratio;
+            int out_frames = (int)frac;
+            frac -= out_frames;
+            return out_frames;
+        }
+
+        double delta = ((double)target_fill - (double)fill) / (double)target_fill;
+        if (delta > 1.0) delta = 1.0;
+        if (delta < -1.0) delta = -1.0;
+
+        frac += in_frames * ratio * (1.0 + max_skew * delta);
+        int out_frames = (int)frac;
+        frac -= out_frames;
+
+        return out_frames;
+    }
+};
+
+// Linear interpolation of an interleaved stereo block, endpoints preserved so
+// consecutive segments join up without a step.
+static inline void ring_resample_stereo(const short *in, int in_frames, short *out, int out_frames)
+{
+    if (in_frames == out_frames || in_frames < 2 || out_frames < 2) {
+        for (int i = 0; i < out_frames; i++) {
+            int s = (i < in_frames) ? i : (in_frames - 1);
+            out[i * 2 + 0] = in[s * 2 + 0];
+            out[i * 2 + 1] = in[s * 2 + 1];
+        }
+        return;
+    }
+
+    const uint32_t step = (uint32_t)((((uint64_t)(in_frames - 1) << 16) + out_frames - 2) / (out_frames - 1));
+    uint32_t pos = 0;
+
+    for (int i = 0; i < out_frames; i++, pos += step) {
+        int s = pos >> 16;
+        int f = (pos & 0xffff) >> 1;
+        if (s >= in_frames - 1) {
+            s = in_frames - 2;
+            f = 0x8000;
+        }
+        const short *a = in + s * 2;
+        out[i * 2 + 0] = (short)(a[0] + (((a[2] - a[0]) * f) >> 15));
+        out[i * 2 + 1] = (short)(a[1] + (((a[3] - a[1]) * f) >> 15));
+    }
+}
+
+#endif // RINGBUFFER_H
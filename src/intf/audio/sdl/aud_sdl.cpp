@@ -3,44 +3,42 @@
 #include <SDL.h>
 #include "burner.h"
 #include "aud_dsp.h"
+#include "ringbuffer.h"
 #include <math.h>
 
 static unsigned int nSoundFps;
 
 extern int delay_ticks(int ticks);
+extern int audiosync;
 
 int nSDLVolume = SDL_MIX_MAXVOLUME;
 int (*GetNextSound)(int);               // Callback used to request more sound
 
 static SDL_AudioSpec audiospec;
 
-static short* SDLAudBuffer;
-static int nSDLPlayPos;
-static int nSDLFillSeg;
-static int nAudLoopLen;
+static ring_buffer<short>* SDLAudRing = NULL;
+static rate_control SDLAudRate;
+static short* SDLAudMixBuffer;			// callback side, one device period
+static short* SDLAudResampleBuffer;		// producer side, one stretched segment
+static int nSDLMixLen;					// device period in samples
+static size_t nSDLTargetFill;			// target ring fill in samples
 
 void audiospec_callback(void* /* data */, Uint8* stream, int len)
 {
 #ifdef BUILD_SDL2
 	SDL_memset(stream, 0, len);
 #endif
-	int end = nSDLPlayPos + len;
-	if (end > nAudLoopLen)
+	int nSamples = len >> 1;
+	if (nSamples > nSDLMixLen)
 	{
-		SDL_MixAudio(stream, (Uint8*)SDLAudBuffer + nSDLPlayPos, nAudLoopLen - nSDLPlayPos, nSDLVolume);
-		end -= nAudLoopLen;
-		SDL_MixAudio(stream + nAudLoopLen - nSDLPlayPos, (Uint8*)SDLAudBuffer, end, nSDLVolume);
-		nSDLPlayPos = end;
+		nSamples = nSDLMixLen;
 	}
-	else
-	{
-		SDL_MixAudio(stream, (Uint8*)SDLAudBuffer + nSDLPlayPos, len, nSDLVolume);
-		nSDLPlayPos = end;
 
-		if (nSDLPlayPos == nAudLoopLen)
-		{
-			nSDLPlayPos = 0;
-		}
+	// On underrun play what we have, the rest of the stream stays silent
+	int nRead = SDLAudRing->read(SDLAudMixBuffer, nSamples & ~1);
+	if (nRead)
+	{
+		SDL_MixAudio(stream, (Uint8*)SDLAudMixBuffer, nRead << 1, nSDLVolume);
 	}
 }
 
@@ -64,52 +62,41 @@ static int SDLSoundBlankSound()
 	return 0;
 }
 
-#define WRAP_INC(x) { x++; if (x >= nAudSegCount) x = 0; }
-
 static int SDLSoundCheck()
 {
-	int nPlaySeg, nFollowingSeg;
-
 	if (!bAudPlaying)
 		return 1;
 
-	// Since the SDL buffer is smaller than a segment, only fill the buffer up to the start of the currently playing segment
-	nPlaySeg = nSDLPlayPos / (nAudSegLen << 2) - 1;
+	size_t nFill = SDLAudRing->size();
 
-	if (nPlaySeg >= nAudSegCount)
-	{
-		nPlaySeg -= nAudSegCount;
-	}
-	if (nPlaySeg < 0)
-	{
-		nPlaySeg = nAudSegCount - 1;
+	if (audiosync) {
+		// the audio device clocks emulation: poll until it has drained below the target,
+		// so one segment (= one frame) is emulated per segment played
+		for (int nWait = 0; nFill >= nSDLTargetFill && nWait < 100; nWait++) {
+			SDL_Delay(1);
+			nFill = SDLAudRing->size();
+		}
 	}
 
-	if (nSDLFillSeg == nPlaySeg) {
+	if (nFill >= nSDLTargetFill) {
 		//	delay_ticks(1);
-			return 0;
-		}
+		return 0;
+	}
 
-	// work out which seg we will fill next
-	nFollowingSeg = nSDLFillSeg;
-	WRAP_INC(nFollowingSeg);
+	// work out how many segs we need to get back to the target latency
+	int nSegs = (int)((nSDLTargetFill - nFill + (nAudSegLen << 1) - 1) / (nAudSegLen << 1));
 
-	while (nSDLFillSeg != nPlaySeg)
+	for (int i = 0; i < nSegs; i++)
 	{
-		int bDraw;
-
-		bDraw = (nFollowingSeg == nPlaySeg);//	|| bAlwaysDrawFrames;	// If this is the last seg of sound, flag bDraw (to draw the graphics)
+		int bDraw = (i == nSegs - 1);//	|| bAlwaysDrawFrames;	// If this is the last seg of sound, flag bDraw (to draw the graphics)
 		GetNextSound(bDraw);                                // get more sound into nAudNextSound
 
-		if (nAudDSPModule[0])
-		{
-			DspDo(nAudNextSound, nAudSegLen);
-		}
-
-		memcpy((char*)SDLAudBuffer + nSDLFillSeg * (nAudSegLen << 2), nAudNextSound, nAudSegLen << 2);
+		DspDo(nAudNextSound, nAudSegLen, nAudDSPModule[0]);
 
-		nSDLFillSeg = nFollowingSeg;
-		WRAP_INC(nFollowingSeg);
+		// nudge the segment length to hold the ring around the target fill
+		int nFrames = SDLAudRate.frames(nAudSegLen, SDLAudRing->size() >> 1, nSDLTargetFill >> 1);
+		ring_resample_stereo(nAudNextSound, nAudSegLen, SDLAudResampleBuffer, nFrames);
+		SDLAudRing->write(SDLAudResampleBuffer, nFrames << 1);
 	}
 
 	return 0;
@@ -120,8 +107,14 @@ static int SDLSoundExit()
 	DspExit();
 	SDL_CloseAudio();
 
-	free(SDLAudBuffer);
-	SDLAudBuffer = NULL;
+	delete SDLAudRing;
+	SDLAudRing = NULL;
+
+	free(SDLAudMixBuffer);
+	SDLAudMixBuffer = NULL;
+
+	free(SDLAudResampleBuffer);
+	SDLAudResampleBuffer = NULL;
 
 	free(nAudNextSound);
 	nAudNextSound = NULL;
@@ -156,8 +149,14 @@ static int SDLSoundInit()
 
 	nSoundFps = nAppVirtualFps;
 	nAudSegLen = (nAudSampleRate[0] * 100 + (nSoundFps >> 1)) / nSoundFps;
-	nAudLoopLen = (nAudSegLen * nAudSegCount) << 2;
-	for (nSDLBufferSize = 64; nSDLBufferSize < (nAudSegLen >> 1); nSDLBufferSize <<= 1)
+	nSDLTargetFill = ((nAudSampleRate[0] * nAudLatency + 999) / 1000) << 1;
+	if (nSDLTargetFill < (size_t)(nAudSegLen << 1))
+	{
+		nSDLTargetFill = nAudSegLen << 1;
+	}
+
+	// keep the device period well under the target latency
+	for (nSDLBufferSize = 64; nSDLBufferSize < (int)(nSDLTargetFill >> 2); nSDLBufferSize <<= 1)
 	{
 
 	}
@@ -168,30 +167,35 @@ static int SDLSoundInit()
 	audiospec_req.samples = nSDLBufferSize;
 	audiospec_req.callback = audiospec_callback;
 
-	SDLAudBuffer = (short*)malloc(nAudLoopLen);
-	if (SDLAudBuffer == NULL)
-	{
-		printf("Couldn't malloc SDLAudBuffer\n");
-		SDLSoundExit();
-		return 1;
-	}
-	memset(SDLAudBuffer, 0, nAudLoopLen);
+	// room for the target, a full device period and a stretched segment on top
+	SDLAudRing = new ring_buffer<short>(nSDLTargetFill + (nSDLBufferSize << 1) + (nAudSegLen << 3));
+	SDLAudRate.reset();
+
+	// nAudSegLen is rounded, stretch each segment to the exact length of one frame
+	// so a 59.19Hz game plays at 59.19Hz when the device is the clock
+	SDLAudRate.set_ratio(audiosync ? ((double)nAudSampleRate[0] * 100.0 / nSoundFps) / nAudSegLen : 1.0);
 
 	nAudNextSound = (short*)malloc(nAudSegLen << 2);
-	if (nAudNextSound == NULL)
+	SDLAudResampleBuffer = (short*)malloc(nAudSegLen << 3);
+	if (nAudNextSound == NULL || SDLAudResampleBuffer == NULL)
 	{
 		SDLSoundExit();
 		return 1;
 	}
 
-	nSDLPlayPos = 0;
-	nSDLFillSeg = nAudSegCount - 1;
-
 	if (SDL_OpenAudio(&audiospec_req, &audiospec))
 	{
 		fprintf(stderr, "Couldn't open audio: %s\n", SDL_GetError());
 		return 1;
 	}
+
+	nSDLMixLen = audiospec.size >> 1;
+	SDLAudMixBuffer = (short*)malloc(audiospec.size);
+	if (SDLAudMixBuffer == NULL)
+	{
+		SDLSoundExit();
+		return 1;
+	}
 	DspInit();
 	SDLSetCallback(NULL);
 
@@ -172,9 +172,7 @@ static int DxSoundCheck()
 		// get more sound into nAudNextSound
 		DSoundGetNextSound((nFollowingSeg == nPlaySeg) || bAlwaysDrawFrames); // If this is the last seg of sound, draw the graphics (frameskipping)
 
-		if (nAudDSPModule[0])	{
-			DspDo(nAudNextSound, nAudSegLen);
-		}
+		DspDo(nAudNextSound, nAudSegLen, nAudDSPModule[0]);
 
 		nDSoundNextSeg = nFollowingSeg;
 		WRAP_INC(nFollowingSeg);
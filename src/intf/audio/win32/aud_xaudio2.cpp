@@ -117,13 +117,11 @@ static int XAudio2Check()
 
 	XAudio2GetNextSound(true);
 
-	// dsp update
-	if (nAudDSPModule[1] & 1) {
-		if (bRunPause)
-			AudWriteSilence();
-		else
-			DspDo(nAudNextSound, nAudSegLen);
-	}
+	// dsp update, reverb is done by the XAudio2 effect below
+	if ((nAudDSPModule[1] & 1) && bRunPause)
+		AudWriteSilence();
+	else
+		DspDo(nAudNextSound, nAudSegLen, nAudDSPModule[1] & ~DSP_REVERB);
 
 	if (nAudDSPModule[1] & 2) {
 		if (!effectEnable) {
@@ -139,7 +139,8 @@ extern INT32 nAudAllocSegLen;
 extern INT16 *nAudNextSound;       	// The next sound seg we will add to the sample loop
 extern UINT8 bAudOkay;    	// True if DSound was initted okay
 extern UINT8 bAudPlaying;	// True if the Loop buffer is playing
-extern INT32 nAudDSPModule[8];			// DSP module to use: 0 = none, 1 = low-pass filter
+extern INT32 nAudDSPModule[8];			// DSP stages to use (aud_dsp.h): 0 = none, 1 = low-pass, 2 = reverb, 4 = stereo widen
+extern INT32 nAudLatency;				// Target latency (ms) for the ring buffer backends (SDL, PulseAudio)
 extern UINT32 nAudSelect;
 
 // Video Output plugin: